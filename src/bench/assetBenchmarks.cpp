@@ -0,0 +1,110 @@
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "src/bench/benchmark.h"
+#include "src/utils/bakedMesh.h"
+#include "src/utils/bakedTexture.h"
+#include "src/utils/imageTexture.h"
+#include "src/utils/meshLoader.h"
+
+namespace Benchmark {
+
+void assets(Suite& suite) {
+    // The paths are relative to the source directory, like those of the game.
+    const std::string meshes[] = {"res/BillDerLachs.obj", "res/Lamp.obj", "res/Sign.obj"};
+    const std::string textures[] = {"res/BillAlbedo.png", "res/LampTexture.png", "res/SignTexture.png",
+                                    "res/starsPX.png"};
+
+    // Parse and weld every obj, the fallback path of the game.
+    for (const std::string& path : meshes) {
+        const std::string name = "MeshLoader::loadObj/" + path;
+        if (!suite.isSelected(name)) {
+            continue;
+        }
+        MeshData mesh;
+        if (!MeshLoader::loadObj(path, mesh)) {
+            fprintf(stderr, "Skipping %s, run the benchmarks from the source directory.\n", name.c_str());
+            continue;
+        }
+        suite.run(name, mesh.cornerAmount, [&]() {
+            MeshLoader::loadObj(path, mesh);
+            consume(static_cast<float>(mesh.vertices.size()));
+        });
+    }
+
+    // Read every baked blob from disk and parse it, the regular path of the game.
+    for (const std::string& path : meshes) {
+        const std::string bakedPath = BakedMesh::pathFor(path);
+        const std::string name = "BakedMesh::read/" + bakedPath;
+        if (!suite.isSelected(name)) {
+            continue;
+        }
+        std::vector<unsigned char> blob;
+        BakedMesh::View view;
+        auto load = [&]() {
+            std::ifstream file(bakedPath, std::ios::binary | std::ios::ate);
+            blob.resize(file ? static_cast<std::size_t>(file.tellg()) : 0);
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+            return BakedMesh::read(blob.data(), blob.size(), view);
+        };
+        if (!load()) {
+            fprintf(stderr, "Skipping %s, build the bake_meshes target first.\n", name.c_str());
+            continue;
+        }
+        suite.run(name, view.vertexAmount, [&]() {
+            load();
+            consume(static_cast<float>(view.vertexAmount));
+        });
+    }
+
+    // Decode every texture into RGBA8888, as uploaded by the game.
+    for (const std::string& path : textures) {
+        const std::string name = "ImageTexture/" + path;
+        if (!suite.isSelected(name)) {
+            continue;
+        }
+        ImageTexture texture(path);
+        if (texture.getWidth() == 0) {
+            fprintf(stderr, "Skipping %s, run the benchmarks from the source directory.\n", name.c_str());
+            continue;
+        }
+        const std::size_t pixels = static_cast<std::size_t>(texture.getWidth()) * texture.getHeight();
+        suite.run(name, pixels, [&]() {
+            ImageTexture decoded(path);
+            consume(static_cast<float>(decoded.getData()[0]));
+        });
+    }
+
+    // Read every baked texture with its mip chain from disk and parse it, the regular path of the game.
+    for (const std::string& path : textures) {
+        const std::string bakedPath = BakedTexture::pathFor(path);
+        const std::string name = "BakedTexture::read/" + bakedPath;
+        if (!suite.isSelected(name)) {
+            continue;
+        }
+        std::vector<unsigned char> blob;
+        BakedTexture::View view;
+        auto load = [&]() {
+            std::ifstream file(bakedPath, std::ios::binary | std::ios::ate);
+            blob.resize(file ? static_cast<std::size_t>(file.tellg()) : 0);
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+            return BakedTexture::read(blob.data(), blob.size(), view);
+        };
+        if (!load()) {
+            fprintf(stderr, "Skipping %s, build the bake_textures target first.\n", name.c_str());
+            continue;
+        }
+        const std::size_t pixels = static_cast<std::size_t>(view.levels[0].width) * view.levels[0].height;
+        suite.run(name, pixels, [&]() {
+            load();
+            consume(static_cast<float>(view.levels.size()));
+        });
+    }
+}
+
+}  // namespace Benchmark
@@ -0,0 +1,81 @@
+#include "src/bench/benchmark.h"
+
+#include <cstdio>
+#include <ctime>
+#include <utility>
+
+namespace Benchmark {
+
+namespace {
+volatile float sink; /**< Receives consumed values, a volatile store can not be removed. */
+
+/**
+ * @brief Writes a string as a JSON string literal, the names only need quotes and backslashes escaped.
+ * @param file - the file.
+ * @param text - the string.
+ */
+void writeJsonString(FILE* file, const std::string& text) {
+    fputc('"', file);
+    for (char character : text) {
+        if (character == '"' || character == '\\') {
+            fputc('\\', file);
+        }
+        fputc(character, file);
+    }
+    fputc('"', file);
+}
+}  // namespace
+
+void consume(float value) { sink = value; }
+
+void print(const Result& result) {
+    printf("%-40s %14.1f ns %16.0f items/s %12llu iterations\n", result.name.c_str(), result.nanosecondsPerIteration(),
+           result.itemsPerSecond(), static_cast<unsigned long long>(result.iterations));
+}
+
+bool writeJson(const std::string& filename, const std::vector<Result>& results) {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (file == nullptr) {
+        fprintf(stderr, "Could not open %s for writing.\n", filename.c_str());
+        return false;
+    }
+
+    // The context tells apart runs of different builds and machines.
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+    fprintf(file, "{\n  \"context\": {\n    \"date\": \"%s\",\n    \"library_build_type\": \"%s\"\n  },\n", date,
+            buildType);
+
+    fprintf(file, "  \"benchmarks\": [");
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        fprintf(file, "%s\n    {\n      \"name\": ", i == 0 ? "" : ",");
+        writeJsonString(file, result.name);
+        fprintf(file,
+                ",\n      \"run_type\": \"iteration\",\n      \"iterations\": %llu,\n"
+                "      \"real_time\": %.3f,\n      \"cpu_time\": %.3f,\n      \"time_unit\": \"ns\",\n"
+                "      \"items\": %zu,\n      \"items_per_second\": %.1f\n    }",
+                static_cast<unsigned long long>(result.iterations), result.nanosecondsPerIteration(),
+                result.cpuSeconds * 1e9 / static_cast<double>(result.iterations), result.items, result.itemsPerSecond());
+    }
+    fprintf(file, "\n  ]\n}\n");
+
+    bool success = ferror(file) == 0;
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        fprintf(stderr, "Could not write %s.\n", filename.c_str());
+    }
+    return success;
+}
+
+Suite::Suite(std::string filter, double minimumSeconds) : _filter(std::move(filter)), _minimumSeconds(minimumSeconds) {}
+
+bool Suite::isSelected(const std::string& name) const { return name.find(_filter) != std::string::npos; }
+
+}  // namespace Benchmark
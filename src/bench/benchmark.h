@@ -0,0 +1,132 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+
+/**
+ * @brief The measurement of a benchmark.
+ */
+struct Result {
+    std::string name;         /**< Name of the benchmark, including its parameters. */
+    std::size_t items;        /**< Amount of items processed per iteration, e.g. obstacles. */
+    std::uint64_t iterations; /**< Amount of measured iterations. */
+    double seconds;           /**< Wall clock time of all measured iterations. */
+    double cpuSeconds;        /**< Processor time of all measured iterations. */
+
+    double nanosecondsPerIteration() const { return seconds * 1e9 / static_cast<double>(iterations); }
+    double itemsPerSecond() const { return static_cast<double>(items) * static_cast<double>(iterations) / seconds; }
+};
+
+/**
+ * @brief Keeps the compiler from optimizing away a computed value.
+ * @param value - the value.
+ */
+void consume(float value);
+
+/**
+ * @brief Prints a result as a line of the result table.
+ * @param result - the result.
+ */
+void print(const Result& result);
+
+/**
+ * @brief Writes results as JSON, in the layout of Google Benchmark so its comparison tools can read them.
+ * @param filename - the path of the file.
+ * @param results - the results.
+ * @return true if it was successful.
+ */
+bool writeJson(const std::string& filename, const std::vector<Result>& results);
+
+/**
+ * @brief Runs a function repeatedly until the minimum time is reached, the amount of iterations doubles per round.
+ * @param name - the name of the benchmark.
+ * @param items - the amount of items processed per call.
+ * @param function - the measured function.
+ * @param minimumSeconds - the minimum time to measure.
+ * @return the measurement of the last round.
+ */
+template <typename Function>
+Result run(const std::string& name, std::size_t items, Function&& function, double minimumSeconds = 0.2) {
+    // Warm up caches and branch predictors.
+    function();
+
+    Result result{name, items, 1, 0.0, 0.0};
+    for (;;) {
+        std::clock_t cpuStart = std::clock();
+        auto start = std::chrono::steady_clock::now();
+        for (std::uint64_t i = 0; i < result.iterations; i++) {
+            function();
+        }
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        if (result.seconds >= minimumSeconds) {
+            return result;
+        }
+        result.iterations *= 2;
+    }
+}
+
+/**
+ * @brief Runs the selected benchmarks, prints their results and collects them for the JSON report.
+ */
+class Suite {
+   public:
+    /**
+     * @brief Creates a suite.
+     * @param filter - only benchmarks whose name contains the filter run, an empty filter runs all.
+     * @param minimumSeconds - the minimum time to measure per benchmark.
+     */
+    Suite(std::string filter, double minimumSeconds);
+
+    /**
+     * @brief Whether a benchmark is selected by the filter, lets callers skip expensive setup.
+     * @param name - the name of the benchmark.
+     * @return true if the benchmark runs.
+     */
+    bool isSelected(const std::string& name) const;
+
+    /**
+     * @brief Runs and prints a benchmark if it is selected.
+     * @param name - the name of the benchmark.
+     * @param items - the amount of items processed per call.
+     * @param function - the measured function.
+     */
+    template <typename Function>
+    void run(const std::string& name, std::size_t items, Function&& function) {
+        if (!isSelected(name)) {
+            return;
+        }
+        _results.push_back(Benchmark::run(name, items, function, _minimumSeconds));
+        print(_results.back());
+    }
+
+    const std::vector<Result>& results() const { return _results; }
+
+   private:
+    std::string _filter;          /**< Substring of the names of the selected benchmarks */
+    double _minimumSeconds;       /**< Minimum time to measure per benchmark */
+    std::vector<Result> _results; /**< Results of all benchmarks run so far */
+};
+
+/**
+ * @brief Benchmarks the simulation core: obstacles, fish physics and collision queries.
+ * @param suite - the suite running the benchmarks.
+ */
+void simulation(Suite& suite);
+
+/**
+ * @brief Benchmarks loading the assets in res/: meshes, baked meshes and textures.
+ * @param suite - the suite running the benchmarks.
+ */
+void assets(Suite& suite);
+
+}  // namespace Benchmark
+
+#endif  // BENCHMARK_H
@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "src/bench/benchmark.h"
+
+/**
+ * Benchmarks of the simulation core and of loading the assets, prints the time per iteration and the throughput per
+ * benchmark. Run from the source directory, so the assets are found.
+ * Usage: floppy_bench [--filter <substring>] [--min-time <seconds>] [--json <file>]
+ */
+int main(int argc, char *argv[]) {
+    std::string filter;
+    double minimumSeconds = 0.2;
+    std::string jsonPath;
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && std::strcmp(argv[i], "--filter") == 0) {
+            filter = argv[++i];
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--min-time") == 0) {
+            minimumSeconds = std::atof(argv[++i]);
+        } else if (i + 1 < argc && std::strcmp(argv[i], "--json") == 0) {
+            jsonPath = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--filter <substring>] [--min-time <seconds>] [--json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Benchmark::Suite suite(filter, minimumSeconds);
+    Benchmark::simulation(suite);
+    Benchmark::assets(suite);
+
+    if (!jsonPath.empty() && !Benchmark::writeJson(jsonPath, suite.results())) {
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "glm/ext/matrix_transform.hpp"
+#include "src/bench/benchmark.h"
+#include "src/config/config.h"
+#include "src/core/collision.h"
+#include "src/core/fishState.h"
+#include "src/core/obstacleCourse.h"
+#include "src/core/random.h"
+
+namespace Benchmark {
+
+void simulation(Suite& suite) {
+    const std::size_t obstacleAmounts[] = {10, 100, 1000, 10000, 100000};
+
+    // Place and randomize all obstacles, as on the start of every game.
+    for (std::size_t amount : obstacleAmounts) {
+        Random random(1);
+        ObstacleCourse course;
+        course.reset(amount, random);
+        suite.run("ObstacleCourse::reset/" + std::to_string(amount), amount, [&]() {
+            course.reset(amount, random);
+            consume(course.x()[0]);
+        });
+    }
+
+    // Scroll and recycle all obstacles by one step.
+    for (std::size_t amount : obstacleAmounts) {
+        Random random(1);
+        ObstacleCourse course;
+        course.reset(amount, random);
+        suite.run("ObstacleCourse::step/" + std::to_string(amount), amount, [&]() {
+            course.step(random);
+            consume(course.x()[0]);
+        });
+    }
+
+    // Write the interpolated view space lights of all obstacles.
+    const glm::mat4 viewMatrix = lookAt(glm::vec3(0.0f, 0.1f, 1.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    for (std::size_t amount : obstacleAmounts) {
+        Random random(1);
+        ObstacleCourse course;
+        course.reset(amount, random);
+        course.step(random);
+        std::vector<glm::vec4> lights(amount);
+        suite.run("ObstacleCourse::writeLights/" + std::to_string(amount), amount, [&]() {
+            course.writeLights(0.5f, viewMatrix, Config::lightRadius, lights.data());
+            consume(lights[0].x);
+        });
+    }
+
+    // Integrate the fish over a game-length sequence of steps, flopping whenever it sinks below the center.
+    const std::size_t fishSteps = 1000;
+    FishState fish;
+    suite.run("FishState::step/" + std::to_string(fishSteps), fishSteps, [&]() {
+        fish.reset();
+        for (std::size_t i = 0; i < fishSteps; i++) {
+            if (fish.position().y < 0.0f) {
+                fish.flop();
+            }
+            fish.step();
+        }
+        consume(fish.position().y);
+    });
+
+    // Query the obstacles once the first one reaches the fish, so the narrow phase runs. The broad phase stops at the
+    // first obstacle right of the fish, a single query should not depend on the amount of obstacles.
+    for (std::size_t amount : {std::size_t{10}, std::size_t{100}, std::size_t{10000}}) {
+        Random random(1);
+        ObstacleCourse course;
+        course.reset(amount, random);
+        FishState queryFish;
+        queryFish.step();
+        while (course.fromLeft(0).x - Config::obstacleWidth > queryFish.position().x + queryFish.width()) {
+            course.step(random);
+        }
+        suite.run("Collision::collides/" + std::to_string(amount), 1, [&]() {
+            float time;
+            consume(Collision::collides(queryFish, course, time) ? time : -1.0f);
+        });
+    }
+}
+
+}  // namespace Benchmark
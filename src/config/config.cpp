@@ -30,7 +30,18 @@ float Config::obstacleDistance = 1.1f;
 float Config::obstacleWidth = 0.1f;
 float Config::obstacleDepth = 1.0f;
 float Config::obstacleSpeed = -0.01f;
+float Config::lightRadius = 1.5f;
 bool Config::showHitbox = false;
+bool Config::showProfiler = false;
+
+// Quality.
+float Config::gpuBudget = 12.0f;
+float Config::oceanQuality = 1.0f;
+unsigned int Config::oceanResolution = 2;
+
+// Simulation.
+float Config::simulationStep = 18.0f;
+unsigned int Config::maxSimulationSteps = 5;
 
 // Animations.
 float Config::animationSpeed = 0.0f;
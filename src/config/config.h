@@ -15,6 +15,10 @@ class Config {
     static float roughness;                  /**< The roughness for cook torrance. */
     static float debugRotation;              /**< Amount of debug rotation to apply (used in debug mode). */
     static bool showHitbox;                  /**< Whether to show the collision-hit-boxes. */
+    static bool showProfiler;                /**< Whether to show the timings of the render passes. */
+    static float gpuBudget;                  /**< GPU time per frame in ms the ocean adapts to, 0 keeps its quality. */
+    static float oceanQuality;               /**< Initial quality of the ocean in [0, 1]. */
+    static unsigned int oceanResolution;     /**< The ocean is rendered at 1/oceanResolution of the resolution. */
     static unsigned int obstacleAmount;      /**< Number of obstacles to spawn. */
     static float obstacleInitialOffset;      /**< Initial offset to the right of the window. */
     static float obstacleLeftOverhang;       /**< Overhang to the left of the window. */
@@ -24,10 +28,13 @@ class Config {
     static float obstacleDistance;           /**< Distance between obstacle. */
     static float obstacleWidth;              /**< Width of the obstacle. */
     static float obstacleDepth;              /**< Depth of the obstacle. */
-    static float obstacleSpeed;              /**< Distance scrolled per frame. */
+    static float obstacleSpeed;              /**< Distance scrolled per simulation step. */
+    static float lightRadius;                /**< Distance at which the light of an obstacle fades out. */
+    static float simulationStep;             /**< Length of a simulation step in ms, the per-step speeds assume it. */
+    static unsigned int maxSimulationSteps;  /**< Maximum simulation steps per frame, slower machines fall behind. */
     static float animationLooper;            /**< A float that loops through [0, 1] for animation purposes. */
     static float animationSpeed;             /**< The number of steps per ms. */
-    static const float verticalAcceleration; /**< Downward acceleration of the fish, will be added to the velocity. */
+    static const float verticalAcceleration; /**< Downward acceleration of the fish, added to the velocity per step. */
     static const float velocityBound;        /**< Lower bound for the downward velocity of the fish. */
     static const float verticalVelocity;     /**< Upward velocity for the flop motion of the fish. */
     static float skyRotation;                /**< Speed at which the skybox rotates. */
@@ -0,0 +1,21 @@
+#include "src/core/autopilot.h"
+
+#include <cstddef>
+
+namespace Autopilot {
+
+bool shouldFlop(const GameState& game) {
+    // Find the first obstacle the fish has not passed yet, the obstacles are sorted from left to right.
+    const FishState& fish = game.fish();
+    const ObstacleCourse& obstacles = game.obstacles();
+    std::size_t order = 0;
+    while (order < obstacles.size() &&
+           obstacles.fromLeft(order).x + Config::obstacleWidth <= fish.position().x - fish.width()) {
+        order++;
+    }
+
+    return order < obstacles.size() && fish.verticalVelocity() <= 0.0f &&
+           fish.position().y - fish.height() < obstacles.fromLeft(order).gapBottom() + 0.04f;
+}
+
+}  // namespace Autopilot
@@ -0,0 +1,21 @@
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#include "src/core/gameState.h"
+
+namespace Autopilot {
+
+/**
+ * @brief Decides whether a simple bot flops in the current step.
+ *
+ * The bot flops whenever the fish falls close to the bottom of the gap of the first obstacle it has not passed yet,
+ * a flop lifts it by about half the gap. It scores reliably without playing perfectly, which gives headless runs
+ * and benchmarks a reproducible, game-like workload.
+ * @param game - the game.
+ * @return true if the fish should flop before the next step.
+ */
+bool shouldFlop(const GameState& game);
+
+}  // namespace Autopilot
+
+#endif  // AUTOPILOT_H
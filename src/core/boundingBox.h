@@ -0,0 +1,28 @@
+#ifndef BOUNDING_BOX_H
+#define BOUNDING_BOX_H
+
+#include "glm/ext/vector_float2.hpp"
+
+/**
+ * @brief An axis aligned box in the xy-plane, the plane in which the game is played.
+ */
+struct BoundingBox {
+    glm::vec2 center;      /**< Center of the box. */
+    glm::vec2 halfExtents; /**< Half of the width and height of the box. */
+
+    float left() const { return center.x - halfExtents.x; }
+    float right() const { return center.x + halfExtents.x; }
+    float bottom() const { return center.y - halfExtents.y; }
+    float top() const { return center.y + halfExtents.y; }
+
+    /**
+     * @brief Whether this box overlaps another box, touching boxes do not overlap.
+     * @param other - the other box.
+     * @return true if the boxes overlap.
+     */
+    bool overlaps(const BoundingBox& other) const {
+        return left() < other.right() && other.left() < right() && bottom() < other.top() && other.bottom() < top();
+    }
+};
+
+#endif  // BOUNDING_BOX_H
@@ -0,0 +1,97 @@
+#include "src/core/collision.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace Collision {
+
+namespace {
+/**
+ * @brief Computes the times at which a moving interval enters and exits a static interval.
+ * @param movingMin - the lower end of the moving interval.
+ * @param movingMax - the upper end of the moving interval.
+ * @param displacement - the displacement of the moving interval.
+ * @param targetMin - the lower end of the static interval.
+ * @param targetMax - the upper end of the static interval.
+ * @param entry - receives the entry time.
+ * @param exit - receives the exit time.
+ * @return false if the intervals never overlap.
+ */
+bool slab(float movingMin, float movingMax, float displacement, float targetMin, float targetMax, float& entry,
+          float& exit) {
+    if (displacement == 0.0f) {
+        // Without movement the intervals overlap always or never.
+        entry = -std::numeric_limits<float>::infinity();
+        exit = std::numeric_limits<float>::infinity();
+        return movingMin < targetMax && targetMin < movingMax;
+    }
+    float first = (targetMin - movingMax) / displacement;
+    float second = (targetMax - movingMin) / displacement;
+    entry = std::min(first, second);
+    exit = std::max(first, second);
+    return true;
+}
+}  // namespace
+
+bool sweep(const BoundingBox& moving, const glm::vec2& displacement, const BoundingBox& target, float& time) {
+    float entryX, exitX, entryY, exitY;
+    if (!slab(moving.left(), moving.right(), displacement.x, target.left(), target.right(), entryX, exitX) ||
+        !slab(moving.bottom(), moving.top(), displacement.y, target.bottom(), target.top(), entryY, exitY)) {
+        return false;
+    }
+
+    // The boxes overlap while both intervals overlap, touching boxes do not overlap. Boxes that meet at the end of
+    // the step only touch, they overlap from the start of the next step on.
+    float entry = std::max(entryX, entryY);
+    float exit = std::min(exitX, exitY);
+    if (entry >= exit || entry >= 1.0f || exit <= 0.0f) {
+        return false;
+    }
+    time = std::max(entry, 0.0f);
+    return true;
+}
+
+bool collides(const FishState& fish, const ObstacleCourse& obstacles, float& time) {
+    // The hitbox of the fish at the start of the step and the box covering its whole movement.
+    BoundingBox fishBox = fish.boundingBox();
+    fishBox.center = glm::vec2(fish.previousPosition().x, fish.previousPosition().y);
+    const float fishLeft = fishBox.left();
+    const float fishRight = fishBox.right() + fish.position().x - fish.previousPosition().x;
+    const float fishMovement = fish.position().y - fish.previousPosition().y;
+
+    bool hit = false;
+    time = 1.0f;
+    for (std::size_t order = 0; order < obstacles.size(); order++) {
+        const ObstacleState obstacle = obstacles.fromLeft(order);
+        const float obstacleLeft = std::min(obstacle.previousX, obstacle.x) - Config::obstacleWidth;
+        const float obstacleRight = std::max(obstacle.previousX, obstacle.x) + Config::obstacleWidth;
+
+        // Skip the obstacles the fish has already passed.
+        if (obstacleRight <= fishLeft) {
+            continue;
+        }
+
+        // All following obstacles are further right, none of them can reach the fish.
+        if (obstacleLeft >= fishRight) {
+            break;
+        }
+
+        // Narrow phase, sweep the fish relative to the obstacle at the start of the step.
+        ObstacleState start = obstacle;
+        start.x = obstacle.previousX;
+        const glm::vec2 displacement(fish.position().x - fish.previousPosition().x - (obstacle.x - obstacle.previousX),
+                                     fishMovement);
+        float partTime;
+        if (sweep(fishBox, displacement, start.lowerBox(), partTime) && partTime <= time) {
+            time = partTime;
+            hit = true;
+        }
+        if (sweep(fishBox, displacement, start.upperBox(), partTime) && partTime <= time) {
+            time = partTime;
+            hit = true;
+        }
+    }
+    return hit;
+}
+
+}  // namespace Collision
@@ -0,0 +1,40 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+
+#include "src/core/fishState.h"
+#include "src/core/obstacleCourse.h"
+
+namespace Collision {
+
+/**
+ * @brief Computes when a moving box starts to overlap a static box during a step.
+ *
+ * Both boxes are extended by each other along the axes and the entry and exit times of the slabs are intersected.
+ * Moving boxes are swept by passing the displacement of one relative to the other.
+ * @param moving - the moving box at the start of the step.
+ * @param displacement - the displacement of the moving box over the whole step.
+ * @param target - the static box.
+ * @param time - receives the time of impact in [0, 1], 0 if the boxes already overlap at the start.
+ * @return true if the boxes overlap at some point of the step.
+ */
+bool sweep(const BoundingBox& moving, const glm::vec2& displacement, const BoundingBox& target, float& time);
+
+/**
+ * @brief Sweeps the hitbox of the fish over the last step against the hitboxes of the obstacle parts.
+ *
+ * The obstacles are sorted by their x-coordinate, which makes the broad phase a sweep and prune along x:
+ * starting at the leftmost obstacle, the obstacles left of the fish are skipped and the sweep stops at the first
+ * obstacle right of the fish. Only the obstacles in between are tested exactly, thus the cost only depends on the
+ * amount of obstacles on screen and not on the amount of queued obstacles.
+ * The exact test sweeps the boxes from their previous to their current step, so the fish can not tunnel through
+ * an obstacle even if it moves further than the width of an obstacle in one step.
+ * @param fish - the fish.
+ * @param obstacles - the obstacles.
+ * @param time - receives the earliest time of impact in [0, 1] of the last step.
+ * @return true if the fish touched the upper or lower part of an obstacle during the last step.
+ */
+bool collides(const FishState& fish, const ObstacleCourse& obstacles, float& time);
+
+}  // namespace Collision
+
+#endif  // COLLISION_H
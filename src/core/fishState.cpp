@@ -0,0 +1,48 @@
+#include "src/core/fishState.h"
+
+#include "glm/common.hpp"
+
+FishState::FishState()
+    : _height(0.08f),
+      _width(0.25f),
+      _verticalVelocity(0.0f),
+      _previousVerticalVelocity(0.0f),
+      _position(0.0f),
+      _previousPosition(0.0f) {}
+
+void FishState::reset() {
+    _verticalVelocity = 0.0f;
+    _previousVerticalVelocity = 0.0f;
+    _position = glm::vec3(0.0f);
+    _previousPosition = glm::vec3(0.0f);
+}
+
+void FishState::step() {
+    // Keep the previous step to interpolate the rendered state.
+    _previousVerticalVelocity = _verticalVelocity;
+    _previousPosition = _position;
+
+    // Slowly revert velocity back to lower velocity bound.
+    if (_verticalVelocity >= Config::velocityBound) {
+        _verticalVelocity += Config::verticalAcceleration;
+    }
+
+    // Update y-coordinate with the current velocity.
+    _position.y += _verticalVelocity;
+}
+
+void FishState::stopAt(float time) {
+    _position = glm::mix(_previousPosition, _position, time);
+    _verticalVelocity = glm::mix(_previousVerticalVelocity, _verticalVelocity, time);
+
+    // Nothing is left to interpolate.
+    _previousPosition = _position;
+    _previousVerticalVelocity = _verticalVelocity;
+}
+
+void FishState::getBounds(float& boundX, float& boundY, float& boundWidth, float& boundHeight) const {
+    boundX = _position.x;
+    boundY = _position.y;
+    boundWidth = _width;
+    boundHeight = _height;
+}
@@ -0,0 +1,72 @@
+#ifndef FISH_STATE_H
+#define FISH_STATE_H
+
+#include "glm/ext/vector_float3.hpp"
+#include "src/config/config.h"
+#include "src/core/boundingBox.h"
+
+/**
+ * @brief The simulated state of the fish, advanced in fixed steps without any OpenGL dependency.
+ *
+ * The state of the previous step is kept, so the renderer can interpolate between the last two steps.
+ */
+class FishState {
+   public:
+    FishState();
+
+    /**
+     * @brief Places the fish at its start position, at rest.
+     */
+    void reset();
+
+    /**
+     * @brief Makes the fish flop upwards.
+     */
+    void flop() { _verticalVelocity = Config::verticalVelocity; }
+
+    /**
+     * @brief Advances the fish by one simulation step, the acceleration and velocity are given per step.
+     */
+    void step();
+
+    /**
+     * @brief Moves the fish back to a point in time of the last step, the step ends there.
+     * @param time - the point in time in [0, 1] of the last step.
+     */
+    void stopAt(float time);
+
+    glm::vec3 position() const { return _position; }
+    glm::vec3 previousPosition() const { return _previousPosition; }
+    float verticalVelocity() const { return _verticalVelocity; }
+    float previousVerticalVelocity() const { return _previousVerticalVelocity; }
+    float width() const { return _width; }
+    float height() const { return _height; }
+
+    /**
+     * @brief Returns the hitbox of the fish, the rotation of the mesh is ignored.
+     * @return the hitbox of the fish.
+     */
+    BoundingBox boundingBox() const {
+        return BoundingBox{glm::vec2(_position.x, _position.y), glm::vec2(_width, _height)};
+    }
+
+    /**
+     * @brief Get the bounding box of the fish.
+     * @param boundX - the x-coordinate of the fish.
+     * @param boundY - the y-coordinate of the fish.
+     * @param boundWidth - the width of the fish.
+     * @param boundHeight - the height of the fish.
+     * @returns the coordinates and dimensions of the fish.
+     */
+    void getBounds(float& boundX, float& boundY, float& boundWidth, float& boundHeight) const;
+
+   private:
+    float _height;                   /**< Height of the fish. */
+    float _width;                    /**< Width of the fish. */
+    float _verticalVelocity;         /**< The current velocity of the fish. */
+    float _previousVerticalVelocity; /**< The velocity of the fish in the previous simulation step. */
+    glm::vec3 _position;             /**< Current position of the fish. */
+    glm::vec3 _previousPosition;     /**< Position of the fish in the previous simulation step. */
+};
+
+#endif  // FISH_STATE_H
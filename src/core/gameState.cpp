@@ -0,0 +1,66 @@
+#include "src/core/gameState.h"
+
+#include "src/config/config.h"
+#include "src/core/collision.h"
+
+GameState::GameState(std::uint32_t seed)
+    : _random(seed), _score(0), _nextGap(0), _tick(0), _over(false), _impactTime(0.0f) {
+    reset(seed);
+}
+
+void GameState::reset(std::uint32_t seed) {
+    _random.reseed(seed);
+    _replay.start(seed);
+    _fish.reset();
+    _obstacles.reset(Config::obstacleAmount, _random);
+    _score = 0;
+    _nextGap = _obstacles.ringIndex(0);
+    _tick = 0;
+    _over = false;
+    _impactTime = 0.0f;
+}
+
+void GameState::flop() {
+    if (_over) {
+        return;
+    }
+    _replay.recordFlop(_tick);
+    _fish.flop();
+}
+
+void GameState::step() {
+    if (_over) {
+        return;
+    }
+
+    _fish.step();
+    _obstacles.step(_random);
+    _tick++;
+    _replay.setLength(_tick);
+
+    // Stop everything where the fish hit the obstacle.
+    if (Collision::collides(_fish, _obstacles, _impactTime)) {
+        _fish.stopAt(_impactTime);
+        _obstacles.stopAt(_impactTime);
+        _over = true;
+        return;
+    }
+
+    // The game ends as well once the fish falls through the floor or rises above the playfield.
+    const float y = _fish.position().y;
+    if (y < ObstacleCourse::floorY() || y > ObstacleCourse::topY()) {
+        _impactTime = 1.0f;
+        _over = true;
+        return;
+    }
+
+    // The fish passed the gap once it is right of the center of the obstacle, the next gap is the one to its right.
+    // It only scores if it crosses the obstacle within the gap.
+    const ObstacleState obstacle = _obstacles[_nextGap];
+    if (obstacle.x < _fish.position().x) {
+        if (obstacle.gapContains(y)) {
+            _score++;
+        }
+        _nextGap = (_nextGap + 1) % _obstacles.size();
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "src/core/fishState.h"
+#include "src/core/obstacleCourse.h"
+#include "src/core/random.h"
+#include "src/core/replay.h"
+
+/**
+ * @brief The complete simulation of a game: the fish, the obstacles, the score and the random engine.
+ *
+ * The game state has no OpenGL or Qt dependency, it is advanced in fixed steps and only read by the renderer.
+ * This allows to simulate games headless, e.g. for bots and balance testing.
+ * The simulation is deterministic, a game is fully defined by its seed and the ticks of its flops, which are
+ * recorded into a replay.
+ */
+class GameState {
+   public:
+    /**
+     * @brief Creates a game and resets it.
+     * @param seed - the seed of the random engine.
+     */
+    explicit GameState(std::uint32_t seed = std::random_device()());
+
+    /**
+     * @brief Restarts the game.
+     * @param seed - the seed of the random engine for the new game.
+     */
+    void reset(std::uint32_t seed);
+
+    /**
+     * @brief Makes the fish flop upwards in the next step and records the flop, ignored once the game is over.
+     */
+    void flop();
+
+    /**
+     * @brief Advances the game by one simulation step of Config::simulationStep ms.
+     *
+     * The fish scores a point for every obstacle it passes through the gap, the game is over once it hits an obstacle
+     * or leaves the playfield through the floor or the top.
+     * The hit is detected continuously, the fish and the obstacles stop at the exact time of impact.
+     * A game that is over does not advance anymore until it is reset.
+     */
+    void step();
+
+    /**
+     * @brief Whether the fish hit an obstacle or left the playfield.
+     * @return true if the game is over.
+     */
+    bool isOver() const { return _over; }
+
+    /**
+     * @brief Returns when the fish hit the obstacle or left the playfield, only valid if the game is over.
+     * @return the tick of the hit plus its time of impact in [0, 1] of that tick.
+     */
+    double impactTick() const { return static_cast<double>(_tick - 1) + _impactTime; }
+
+    const FishState& fish() const { return _fish; }
+    const ObstacleCourse& obstacles() const { return _obstacles; }
+    unsigned int score() const { return _score; }
+    std::uint64_t tick() const { return _tick; }
+    const Replay& replay() const { return _replay; }
+
+   private:
+    Random _random;            /**< The random engine of the game, seeded on every reset. */
+    Replay _replay;            /**< The seed and the inputs of the game. */
+    FishState _fish;           /**< The fish. */
+    ObstacleCourse _obstacles; /**< The obstacles. */
+    unsigned int _score;       /**< The amount of passed obstacles. */
+    std::size_t _nextGap;      /**< Index of the next obstacle the fish has to pass to score. */
+    std::uint64_t _tick;       /**< The amount of simulated steps since the last reset. */
+    bool _over;                /**< Whether the fish hit an obstacle or left the playfield. */
+    float _impactTime;         /**< Time of impact in [0, 1] of the last step, if the fish hit an obstacle. */
+};
+
+#endif  // GAME_STATE_H
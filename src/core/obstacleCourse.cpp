@@ -0,0 +1,145 @@
+#include "src/core/obstacleCourse.h"
+
+// SSE2 is part of every x86-64 processor, other architectures use the scalar loops.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLOPPY_SSE2
+#include <emmintrin.h>
+#endif
+
+void ObstacleCourse::reset(std::size_t amount, Random& random) {
+    for (std::vector<float>* array :
+         {&_x, &_previousX, &_lowerHeight, &_upperHeight, &_lowerRotation, &_upperRotation, &_lightY}) {
+        array->resize(amount);
+    }
+    _leftmost = 0;
+    for (std::size_t i = 0; i < amount; i++) {
+        // Place the obstacle to the right of the window.
+        float initialOffset = Config::obstacleInitialOffset + (i * Config::obstacleDistance);
+        _x[i] = 1 + initialOffset + (Config::obstacleWidth / 2);
+        _previousX[i] = _x[i];
+        randomize(i, random);
+    }
+}
+
+void ObstacleCourse::step(Random& random) {
+    const std::size_t amount = _x.size();
+    const float bound = leftBound();
+    const float shift = static_cast<float>(amount) * Config::obstacleDistance;
+    const float speed = Config::obstacleSpeed;
+    float* x = _x.data();
+    float* previousX = _previousX.data();
+
+    // Place the obstacles out of bounds to the right of the other obstacles and keep the result as the previous
+    // step, so the wrapped obstacles snap instead of interpolating across the window. Then scroll all obstacles,
+    // the speed is given per simulation step. Obstacles within bounds are shifted by 0, which is exact.
+    std::size_t i = 0;
+#ifdef FLOPPY_SSE2
+    const __m128 bounds = _mm_set1_ps(bound);
+    const __m128 shifts = _mm_set1_ps(shift);
+    const __m128 speeds = _mm_set1_ps(speed);
+    for (; i + 4 <= amount; i += 4) {
+        __m128 position = _mm_loadu_ps(x + i);
+        const __m128 outOfBounds = _mm_cmplt_ps(position, bounds);
+        position = _mm_add_ps(position, _mm_and_ps(outOfBounds, shifts));
+        _mm_storeu_ps(previousX + i, position);
+        _mm_storeu_ps(x + i, _mm_add_ps(position, speeds));
+
+        // Only the lanes that wrapped take the reset path.
+        const int wrapped = _mm_movemask_ps(outOfBounds);
+        for (int lane = 0; wrapped != 0 && lane < 4; lane++) {
+            if ((wrapped & (1 << lane)) != 0) {
+                recycle(i + lane, random);
+            }
+        }
+    }
+#endif
+    for (; i < amount; i++) {
+        const bool outOfBounds = x[i] < bound;
+        const float position = outOfBounds ? x[i] + shift : x[i];
+        previousX[i] = position;
+        x[i] = position + speed;
+        if (outOfBounds) {
+            recycle(i, random);
+        }
+    }
+}
+
+void ObstacleCourse::recycle(std::size_t index, Random& random) {
+    randomize(index, random);
+
+    // Only the leftmost obstacle leaves the window, the next one takes its place.
+    _leftmost = _leftmost + 1 < _x.size() ? _leftmost + 1 : 0;
+}
+
+void ObstacleCourse::writeLights(float interpolation, const glm::mat4& viewMatrix, float radius,
+                                 glm::vec4* lights) const {
+    const std::size_t amount = _x.size();
+    const float* x = _x.data();
+    const float* previousX = _previousX.data();
+    const float* y = _lightY.data();
+
+    // The lights share their z-coordinate, its contribution is folded into the translation.
+    const float z = Config::obstacleDepth / 2;
+    const glm::vec4 translation = viewMatrix[2] * z + viewMatrix[3];
+
+    std::size_t i = 0;
+#ifdef FLOPPY_SSE2
+    const __m128 interpolations = _mm_set1_ps(interpolation);
+    const __m128 radii = _mm_set1_ps(radius);
+    __m128 xFactors[3], yFactors[3], translations[3];
+    for (int row = 0; row < 3; row++) {
+        xFactors[row] = _mm_set1_ps(viewMatrix[0][row]);
+        yFactors[row] = _mm_set1_ps(viewMatrix[1][row]);
+        translations[row] = _mm_set1_ps(translation[row]);
+    }
+    for (; i + 4 <= amount; i += 4) {
+        // Interpolate the x-coordinates of four lights.
+        const __m128 previous = _mm_loadu_ps(previousX + i);
+        const __m128 px = _mm_add_ps(previous, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(x + i), previous), interpolations));
+        const __m128 py = _mm_loadu_ps(y + i);
+
+        // Transform them into view space, one coordinate of all four lights at a time.
+        __m128 coordinates[3];
+        for (int row = 0; row < 3; row++) {
+            coordinates[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(px, xFactors[row]), _mm_mul_ps(py, yFactors[row])),
+                                          translations[row]);
+        }
+
+        // Transpose into one light per register and store them, the lights are tightly packed.
+        static_assert(sizeof(glm::vec4) == 4 * sizeof(float));
+        __m128 light0 = coordinates[0], light1 = coordinates[1], light2 = coordinates[2], light3 = radii;
+        _MM_TRANSPOSE4_PS(light0, light1, light2, light3);
+        float* output = &lights[i][0];
+        _mm_storeu_ps(output, light0);
+        _mm_storeu_ps(output + 4, light1);
+        _mm_storeu_ps(output + 8, light2);
+        _mm_storeu_ps(output + 12, light3);
+    }
+#endif
+    for (; i < amount; i++) {
+        const float px = previousX[i] + (x[i] - previousX[i]) * interpolation;
+        lights[i] = glm::vec4(viewMatrix[0][0] * px + viewMatrix[1][0] * y[i] + translation[0],
+                              viewMatrix[0][1] * px + viewMatrix[1][1] * y[i] + translation[1],
+                              viewMatrix[0][2] * px + viewMatrix[1][2] * y[i] + translation[2], radius);
+    }
+}
+
+void ObstacleCourse::stopAt(float time) {
+    for (std::size_t i = 0; i < _x.size(); i++) {
+        _x[i] = _previousX[i] + (_x[i] - _previousX[i]) * time;
+        _previousX[i] = _x[i];
+    }
+}
+
+void ObstacleCourse::randomize(std::size_t index, Random& random) {
+    // Set new random rotations.
+    _upperRotation[index] = random.uniform(-45.0f, 45.0f);
+    _lowerRotation[index] = random.uniform(-45.0f, 45.0f);
+
+    // The lower part gets a random height, the upper part fills the rest above the gap.
+    _lowerHeight[index] = random.uniform(Config::obstacleLowerBound, Config::obstacleUpperBound);
+    _upperHeight[index] = 2 - (_lowerHeight[index] + Config::obstacleGapHeight);
+
+    // The light sits on top of the lower part.
+    _lightY[index] = (*this)[index].gapBottom();
+}
@@ -0,0 +1,179 @@
+#ifndef OBSTACLE_COURSE_H
+#define OBSTACLE_COURSE_H
+
+#include <cstddef>
+#include <vector>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "glm/ext/vector_float4.hpp"
+#include "src/config/config.h"
+#include "src/core/boundingBox.h"
+#include "src/core/random.h"
+
+/**
+ * @brief The state of one obstacle, a lower and an upper part with a gap in between.
+ *
+ * The parts are boxes centered at their y-coordinate, their half extents are the obstacle width and their height.
+ * The course stores its obstacles as arrays, this is a copy of one obstacle gathered from them.
+ */
+struct ObstacleState {
+    float x;             /**< X-coordinate of the obstacle. */
+    float previousX;     /**< X-coordinate in the previous simulation step, equal to x after a wrap. */
+    float lowerHeight;   /**< Height of the lower part. */
+    float upperHeight;   /**< Height of the upper part. */
+    float lowerRotation; /**< Rotation of the mesh of the lower part in degrees. */
+    float upperRotation; /**< Rotation of the mesh of the upper part in degrees. */
+
+    float lowerY() const { return (0.5f * lowerHeight) - 1.0f; }
+    float upperY() const { return 2.0f - (0.5f * upperHeight); }
+    float gapBottom() const { return lowerY() + lowerHeight; }
+    float gapTop() const { return upperY() - upperHeight; }
+
+    /**
+     * @brief Whether a height lies within the gap, the edges of the gap included.
+     * @param y - the height.
+     * @return true if y is within [gapBottom(), gapTop()].
+     */
+    bool gapContains(float y) const { return y >= gapBottom() && y <= gapTop(); }
+
+    /**
+     * @brief Returns the hitbox of the lower part.
+     * @return the hitbox of the lower part.
+     */
+    BoundingBox lowerBox() const {
+        return BoundingBox{glm::vec2(x, lowerY()), glm::vec2(Config::obstacleWidth, lowerHeight)};
+    }
+
+    /**
+     * @brief Returns the hitbox of the upper part.
+     * @return the hitbox of the upper part.
+     */
+    BoundingBox upperBox() const {
+        return BoundingBox{glm::vec2(x, upperY()), glm::vec2(Config::obstacleWidth, upperHeight)};
+    }
+};
+
+/**
+ * @brief The obstacles of a game, scrolled in fixed steps and recycled once they leave the window to the left.
+ *
+ * The obstacles are stored as a struct of arrays, one contiguous array per property, so the scrolling of all
+ * obstacles and the gathering of their lights run over four obstacles at once with SSE2, with a scalar fallback.
+ * All obstacles scroll at the same speed and a recycled obstacle is placed behind the last one, thus the arrays
+ * form a ring buffer sorted by the x-coordinate: only the slot at the head of the ring can leave the window, it is
+ * recycled and the head moves on to the next slot.
+ */
+class ObstacleCourse {
+   public:
+    ObstacleCourse() : _leftmost(0) {}
+
+    /**
+     * @brief Places the obstacles to the right of the window with random gaps.
+     * @param amount - the amount of obstacles.
+     * @param random - the random engine of the game.
+     */
+    void reset(std::size_t amount, Random& random);
+
+    /**
+     * @brief Scrolls all obstacles by one simulation step, obstacles out of bounds get placed behind the last one.
+     * @param random - the random engine of the game.
+     */
+    void step(Random& random);
+
+    /**
+     * @brief Writes the lights on top of the lower parts, placed between the last two steps.
+     * @param interpolation - the progress from the previous to the current simulation step in [0, 1].
+     * @param viewMatrix - the affine transformation of the lights into view space.
+     * @param radius - the radius of the lights, stored in w.
+     * @param lights - receives the view space position and radius of every obstacle, size() lights.
+     */
+    void writeLights(float interpolation, const glm::mat4& viewMatrix, float radius, glm::vec4* lights) const;
+
+    /**
+     * @brief Moves all obstacles back to a point in time of the last step, the step ends there.
+     * @param time - the point in time in [0, 1] of the last step.
+     */
+    void stopAt(float time);
+
+    /**
+     * @brief Returns the x-coordinate below which an obstacle left the window to the left.
+     * @return the left bound of the obstacles.
+     */
+    static float leftBound() { return -1 - (Config::obstacleWidth / 2) - Config::obstacleLeftOverhang; }
+
+    /**
+     * @brief Returns the y-coordinate of the floor of the playfield, the lower parts stand on it.
+     * @return the lower bound of the playfield.
+     */
+    static float floorY() { return -1.0f; }
+
+    /**
+     * @brief Returns the y-coordinate of the top of the playfield, the upper parts hang from it.
+     * @return the upper bound of the playfield.
+     */
+    static float topY() { return 2.0f; }
+
+    /**
+     * @brief Whether an obstacle left the window to the left.
+     * @param obstacle - the obstacle.
+     * @return true if the obstacle is out of bounds.
+     */
+    static bool isOutOfBounds(const ObstacleState& obstacle) { return obstacle.x < leftBound(); }
+
+    /**
+     * @brief Gathers the state of an obstacle from the arrays.
+     * @param index - the index of the slot of the obstacle.
+     * @return the obstacle.
+     */
+    ObstacleState operator[](std::size_t index) const {
+        return ObstacleState{_x[index],           _previousX[index],     _lowerHeight[index],
+                             _upperHeight[index], _lowerRotation[index], _upperRotation[index]};
+    }
+
+    /**
+     * @brief Returns the obstacles ordered by their x-coordinate.
+     * @param order - the position of the obstacle from the left, starting at 0 and less than the size.
+     * @return the obstacle.
+     */
+    ObstacleState fromLeft(std::size_t order) const { return (*this)[ringIndex(order)]; }
+
+    /**
+     * @brief Converts the position of an obstacle from the left into the index of its slot.
+     * @param order - the position of the obstacle from the left, starting at 0 and less than the size.
+     * @return the index of the obstacle.
+     */
+    std::size_t ringIndex(std::size_t order) const {
+        std::size_t index = _leftmost + order;
+        return index < _x.size() ? index : index - _x.size();
+    }
+
+    std::size_t size() const { return _x.size(); }
+    const std::vector<float>& x() const { return _x; }
+    const std::vector<float>& previousX() const { return _previousX; }
+    const std::vector<float>& lightY() const { return _lightY; }
+
+   private:
+    /**
+     * @brief Recycles the obstacle in a slot that was placed behind the last obstacle and moves on the head.
+     * @param index - the index of the slot, the head of the ring.
+     * @param random - the random engine of the game.
+     */
+    void recycle(std::size_t index, Random& random);
+
+    /**
+     * @brief Gives the obstacle in a slot new random rotations and a new random gap.
+     * @param index - the index of the slot.
+     * @param random - the random engine of the game.
+     */
+    void randomize(std::size_t index, Random& random);
+
+    std::vector<float> _x;             /**< X-coordinates of the obstacles. */
+    std::vector<float> _previousX;     /**< X-coordinates in the previous simulation step. */
+    std::vector<float> _lowerHeight;   /**< Heights of the lower parts. */
+    std::vector<float> _upperHeight;   /**< Heights of the upper parts. */
+    std::vector<float> _lowerRotation; /**< Rotations of the meshes of the lower parts in degrees. */
+    std::vector<float> _upperRotation; /**< Rotations of the meshes of the upper parts in degrees. */
+    std::vector<float> _lightY;        /**< Y-coordinates of the light sources, at the bottom of the gaps. */
+    std::size_t _leftmost;             /**< Index of the slot of the leftmost obstacle, the head of the ring. */
+};
+
+#endif  // OBSTACLE_COURSE_H
@@ -0,0 +1,65 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+/**
+ * @brief A small and fast pseudo random number generator (xoshiro128**).
+ *
+ * Unlike the engines and distributions of the standard library, the generated numbers are identical on every
+ * platform and standard library, which makes seeded games reproducible bit by bit.
+ */
+class Random {
+   public:
+    explicit Random(std::uint32_t seed = 0) { reseed(seed); }
+
+    /**
+     * @brief Restarts the sequence, equal seeds generate equal sequences.
+     * @param seed - the seed.
+     */
+    void reseed(std::uint32_t seed) {
+        // Expand the seed into the state with splitmix64, the state must not be all zero.
+        std::uint64_t mix = seed;
+        for (std::uint32_t& word : _state) {
+            mix += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = mix;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = static_cast<std::uint32_t>((z ^ (z >> 31)) >> 32);
+        }
+    }
+
+    /**
+     * @brief Generates the next number of the sequence.
+     * @return a uniformly distributed 32 bit number.
+     */
+    std::uint32_t next() {
+        const std::uint32_t result = rotateLeft(_state[1] * 5, 7) * 9;
+        const std::uint32_t t = _state[1] << 9;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = rotateLeft(_state[3], 11);
+        return result;
+    }
+
+    /**
+     * @brief Generates a uniformly distributed float.
+     * @param min - the lower bound, included.
+     * @param max - the upper bound, excluded.
+     * @return a float in [min, max).
+     */
+    float uniform(float min, float max) {
+        // The upper 24 bits fill the mantissa exactly.
+        return min + (max - min) * (static_cast<float>(next() >> 8) * (1.0f / 16777216.0f));
+    }
+
+   private:
+    static std::uint32_t rotateLeft(std::uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    std::uint32_t _state[4]; /**< The state of the generator. */
+};
+
+#endif  // RANDOM_H
@@ -0,0 +1,152 @@
+#include "src/core/replay.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "src/core/gameState.h"
+
+namespace {
+const char magic[4] = {'F', 'F', 'R', 'P'};
+
+/**
+ * @brief Appends a number as LEB128 varint, 7 bits per byte with the highest bit marking a following byte.
+ * @param data - the data to append to.
+ * @param value - the number.
+ */
+void writeVarint(std::vector<unsigned char>& data, std::uint64_t value) {
+    while (value >= 0x80) {
+        data.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back(static_cast<unsigned char>(value));
+}
+
+/**
+ * @brief Reads a LEB128 varint.
+ * @param data - the data, advanced past the number.
+ * @param end - the end of the data.
+ * @param value - receives the number.
+ * @return false if the data ends within the number or the number does not fit into 64 bits.
+ */
+bool readVarint(const unsigned char*& data, const unsigned char* end, std::uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && data < end; shift += 7) {
+        unsigned char byte = *data++;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+}  // namespace
+
+Replay::Replay() : _seed(0), _length(0) {
+    // Leave room for the flops of long games, so recording does not allocate while playing.
+    _flopTicks.reserve(4096);
+}
+
+void Replay::start(std::uint32_t seed) {
+    _seed = seed;
+    _length = 0;
+    _flopTicks.clear();
+}
+
+void Replay::recordFlop(std::uint64_t tick) {
+    if (_flopTicks.empty() || _flopTicks.back() != tick) {
+        _flopTicks.push_back(tick);
+    }
+}
+
+void Replay::play(GameState& game) const {
+    game.reset(_seed);
+    std::size_t flop = 0;
+    while (game.tick() < _length && !game.isOver()) {
+        // Apply the inputs in the same order as while recording, flops come before the step of their tick.
+        if (flop < _flopTicks.size() && _flopTicks[flop] == game.tick()) {
+            game.flop();
+            flop++;
+        }
+        game.step();
+    }
+}
+
+bool Replay::save(const std::string& filename) const {
+    // The header is stored byte by byte, so the file does not depend on the endianness.
+    std::vector<unsigned char> data(std::begin(magic), std::end(magic));
+    for (std::uint32_t value : {version, _seed}) {
+        for (int byte = 0; byte < 4; byte++) {
+            data.push_back(static_cast<unsigned char>(value >> (8 * byte)));
+        }
+    }
+    writeVarint(data, _length);
+    writeVarint(data, _flopTicks.size());
+    std::uint64_t previous = 0;
+    for (std::uint64_t tick : _flopTicks) {
+        writeVarint(data, tick - previous);
+        previous = tick;
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        fprintf(stderr, "%s: cannot open file for writing\n", filename.c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    return file.good();
+}
+
+bool Replay::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "%s: cannot open file for reading\n", filename.c_str());
+        return false;
+    }
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    // Validate the header.
+    const std::size_t headerSize = sizeof(magic) + 8;
+    if (data.size() < headerSize || std::memcmp(data.data(), magic, sizeof(magic)) != 0) {
+        fprintf(stderr, "%s: not a replay\n", filename.c_str());
+        return false;
+    }
+    std::uint32_t header[2] = {0, 0};
+    for (int value = 0; value < 2; value++) {
+        for (int byte = 0; byte < 4; byte++) {
+            header[value] |= static_cast<std::uint32_t>(data[sizeof(magic) + 4 * value + byte]) << (8 * byte);
+        }
+    }
+    if (header[0] != version) {
+        fprintf(stderr, "%s: unsupported replay version %u\n", filename.c_str(), header[0]);
+        return false;
+    }
+
+    // Decode the length and the flop ticks.
+    const unsigned char* position = data.data() + headerSize;
+    const unsigned char* end = data.data() + data.size();
+    std::uint64_t length, flopAmount;
+    if (!readVarint(position, end, length) || !readVarint(position, end, flopAmount) ||
+        flopAmount > static_cast<std::uint64_t>(end - position)) {
+        fprintf(stderr, "%s: truncated replay\n", filename.c_str());
+        return false;
+    }
+    std::vector<std::uint64_t> flopTicks(flopAmount);
+    std::uint64_t tick = 0;
+    for (std::uint64_t& flopTick : flopTicks) {
+        std::uint64_t delta;
+        if (!readVarint(position, end, delta)) {
+            fprintf(stderr, "%s: truncated replay\n", filename.c_str());
+            return false;
+        }
+        tick += delta;
+        flopTick = tick;
+    }
+
+    _seed = header[1];
+    _length = length;
+    _flopTicks = std::move(flopTicks);
+    return true;
+}
@@ -0,0 +1,71 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameState;
+
+/**
+ * @brief The inputs of a game, enough to replay it bit-exactly as the simulation is deterministic.
+ *
+ * A replay stores the seed of the game, the amount of simulated ticks and the ticks at which the fish flopped.
+ * On disk all numbers after the header are LEB128 varints and the flop ticks are stored as deltas, a flop
+ * usually costs a single byte.
+ */
+class Replay {
+   public:
+    static constexpr std::uint32_t version = 1; /**< The version of the file format */
+
+    Replay();
+
+    /**
+     * @brief Clears the replay for a new game.
+     * @param seed - the seed of the new game.
+     */
+    void start(std::uint32_t seed);
+
+    /**
+     * @brief Records a flop before the given tick is simulated, repeated flops in the same tick are dropped.
+     * @param tick - the amount of simulated ticks at the time of the flop.
+     */
+    void recordFlop(std::uint64_t tick);
+
+    /**
+     * @brief Sets the amount of simulated ticks.
+     * @param ticks - the amount of ticks.
+     */
+    void setLength(std::uint64_t ticks) { _length = ticks; }
+
+    std::uint32_t seed() const { return _seed; }
+    std::uint64_t length() const { return _length; }
+    const std::vector<std::uint64_t>& flopTicks() const { return _flopTicks; }
+
+    /**
+     * @brief Simulates the recorded game as fast as possible.
+     * @param game - the game to reset and replay the inputs into.
+     */
+    void play(GameState& game) const;
+
+    /**
+     * @brief Writes the replay into a file.
+     * @param filename - the path of the file.
+     * @return true on success.
+     */
+    bool save(const std::string& filename) const;
+
+    /**
+     * @brief Reads a replay from a file.
+     * @param filename - the path of the file.
+     * @return true on success, the replay is unchanged on failure.
+     */
+    bool load(const std::string& filename);
+
+   private:
+    std::uint32_t _seed;                   /**< The seed of the game. */
+    std::uint64_t _length;                 /**< The amount of simulated ticks. */
+    std::vector<std::uint64_t> _flopTicks; /**< The ticks before which the fish flopped, ascending. */
+};
+
+#endif  // REPLAY_H
@@ -3,9 +3,14 @@
 #include "src/drawables/drawable.h"
 
 #include <QFile>
+#include <QFileInfo>
+#include <algorithm>
+#include <cstddef>
+#include <unordered_map>
 #include <QOpenGLShaderProgram>
 
-#include "src/utils/imageTexture.h"
+#include "src/drawables/frameUniforms.h"
+#include "src/drawables/shaderProgramCache.h"
 
 Drawable::Drawable() : _modelViewMatrix(1.0f), _vertexArrayObject(0), _program(0) {}
 Drawable::Drawable(Drawable const &d) : _modelViewMatrix(1.0f), _vertexArrayObject(0), _program(0) {}
@@ -16,13 +21,31 @@ void Drawable::init() {
     initializeOpenGLFunctions();
 }
 
+QString Drawable::resolveIncludes(const QString &source, const QString &directory) {
+    // Replace every '#include "file"' line with the content of the file, which lives next to the shader.
+    QStringList lines = source.split('\n');
+    for (QString &line : lines) {
+        if (!line.startsWith("#include \"")) {
+            continue;
+        }
+        QString includePath = directory + "/" + line.section('"', 1, 1);
+        QFile includeFile(includePath);
+        if (!includeFile.open(QFile::ReadOnly | QFile::Text)) {
+            qDebug() << "Could not open include file: " << includePath;
+            continue;
+        }
+        line = QTextStream(&includeFile).readAll();
+    }
+    return lines.join('\n');
+}
+
 GLuint Drawable::compileShader(GLenum type, const std::string &path) {
     QFile f(path.c_str());
     if (!f.open(QFile::ReadOnly | QFile::Text)) {
         qDebug() << "Could not open file: " << path;
     }
     QTextStream in(&f);
-    std::string src = in.readAll().toStdString();
+    std::string src = resolveIncludes(in.readAll(), QFileInfo(QString::fromStdString(path)).path()).toStdString();
 
     GLuint shader = glCreateShader(type);
     const GLchar *glsrc = src.c_str();
@@ -74,60 +97,186 @@ GLuint Drawable::linkProgram(GLuint program) {
         qDebug() << "OpenGL program '%s': WARNING:\n" << log;
     } else if (e != GL_TRUE) {
         qDebug() << "OpenGL program '%s': ERROR:\n" << log;
+        glDeleteProgram(program);
         program = 0;
     }
     return program;
 }
 
-GLuint Drawable::loadTexture(std::string path, TextureType type) {
-    ImageTexture image(path);
+void Drawable::loadProgram(const std::string &vertexShaderPath, const std::string &fragmentShaderPath) {
+    // Programs are shared between all drawables using the same shaders.
+    std::string name = vertexShaderPath + " + " + fragmentShaderPath;
+    if (std::shared_ptr<ShaderProgram> cached = ShaderProgramCache::find(name)) {
+        _shaderProgram = cached;
+        _program = _shaderProgram->handle();
+        return;
+    }
 
-    GLuint textureID;
+    // Create a program.
+    GLuint program = glCreateProgram();
 
-    glActiveTexture(GL_TEXTURE0);
+    // Compile shader.
+    GLuint vs = compileShader(GL_VERTEX_SHADER, vertexShaderPath);
+    GLuint fs = compileShader(GL_FRAGMENT_SHADER, fragmentShaderPath);
 
-    // Generate and bind texture.
-    // Allocate one texture, and assign the openGL handle (akin to a pointer).
-    glGenTextures(1, &textureID);
-    // Makes all following texture methods work on the bound texture.
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    // Attach shader to the program.
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+
+    // Link program, the shaders are only flagged for deletion and freed together with the program.
+    program = linkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    std::unordered_map<std::string, GLint> uniformLocations;
+    if (program != 0) {
+        // Bind the per-frame uniform block, if the program uses it.
+        GLuint blockIndex = glGetUniformBlockIndex(program, FrameUniforms::blockName);
+        if (blockIndex != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, blockIndex, FrameUniforms::bindingPoint);
+        }
+
+        // Resolve the locations of all active uniforms.
+        GLint uniformAmount, maxNameLength;
+        glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformAmount);
+        glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+        std::vector<GLchar> nameBuffer(std::max(maxNameLength, 1));
+        for (GLint i = 0; i < uniformAmount; i++) {
+            GLsizei length;
+            GLint size;
+            GLenum type;
+            glGetActiveUniform(program, i, nameBuffer.size(), &length, &size, &type, nameBuffer.data());
+            std::string uniformName(nameBuffer.data(), length);
+            GLint location = glGetUniformLocation(program, uniformName.c_str());
+            // Members of uniform blocks have no location.
+            if (location == -1) {
+                continue;
+            }
+            // Arrays are reported as their first element, store them under their plain name.
+            if (uniformName.ends_with("[0]")) {
+                uniformName.resize(uniformName.size() - 3);
+            }
+            uniformLocations[uniformName] = location;
+        }
+    }
+
+    _shaderProgram = std::make_shared<ShaderProgram>(program, name, std::move(uniformLocations));
+    _program = program;
+    ShaderProgramCache::insert(name, _shaderProgram);
+}
 
-    // Assign image data.
+std::shared_ptr<Texture> Drawable::loadTexture(std::string path, TextureType type) {
+    // Select the internal format, a baked texture is only used if its blocks decode to this format.
+    GLenum internalFormat;
     switch (type) {
         case Monochrome:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, image.getWidth(), image.getHeight(), 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                         image.getData());
+            internalFormat = GL_RED;
             break;
 
         case RGB:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image.getWidth(), image.getHeight(), 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                         image.getData());
+            internalFormat = GL_RGBA;
             break;
 
         case NormalMap:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, image.getWidth(), image.getHeight(), 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                         image.getData());
+            internalFormat = GL_RGB;
             break;
 
         case SRGB:
         default:
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_SRGB_ALPHA, image.getWidth(), image.getHeight(), 0, GL_RGBA,
-                         GL_UNSIGNED_BYTE, image.getData());
+            internalFormat = GL_SRGB_ALPHA;
             break;
     }
 
+    // The baked texture or the image is loaded in the background and uploaded by the texture loader, which also
+    // provides the mipmaps. A texture already in use is shared.
+    std::shared_ptr<Texture> texture = TextureCache::load({path}, GL_TEXTURE_2D, internalFormat);
+
+    glActiveTexture(GL_TEXTURE0);
+
+    // Makes all following texture methods work on the bound texture.
+    glBindTexture(GL_TEXTURE_2D, texture->handle);
+
     // Set texture parameters.
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
     // Make magnification use nearest, in order to preserve pixel look.
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glGenerateMipmap(GL_TEXTURE_2D);
 
     // Retrieve maximum supported anisotropy level, and set it.
     GLfloat maxAnisotropy;
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &maxAnisotropy);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, maxAnisotropy);
 
-    return textureID;
+    return texture;
+}
+
+GLuint Drawable::createVertexArray(const Vertex *vertices, size_t vertexAmount, const void *indexData,
+                                   GLsizeiptr indexDataSize, GLuint *vertexBuffer, GLuint *indexBuffer) {
+    GLuint vertexArrayObject;
+    glGenVertexArrays(1, &vertexArrayObject);
+    glBindVertexArray(vertexArrayObject);
+
+    // Fill a single buffer with the interleaved vertices.
+    GLuint createdVertexBuffer;
+    glGenBuffers(1, &createdVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, createdVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertexAmount * sizeof(Vertex), vertices, GL_STATIC_DRAW);
+    setVertexAttributes();
+
+    GLuint createdIndexBuffer = 0;
+    if (indexData != nullptr) {
+        glGenBuffers(1, &createdIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, createdIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexDataSize, indexData, GL_STATIC_DRAW);
+    }
+
+    // Unbind vertex array object.
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Hand out the buffers or delete them (the data is stored in the vertex array object).
+    if (vertexBuffer != nullptr) {
+        *vertexBuffer = createdVertexBuffer;
+    } else {
+        glDeleteBuffers(1, &createdVertexBuffer);
+    }
+    if (indexBuffer != nullptr) {
+        *indexBuffer = createdIndexBuffer;
+    } else if (createdIndexBuffer != 0) {
+        glDeleteBuffers(1, &createdIndexBuffer);
+    }
+
+    return vertexArrayObject;
+}
+
+GLuint Drawable::createSharedVertexArray(GLuint vertexBuffer, GLuint indexBuffer) {
+    GLuint vertexArrayObject;
+    glGenVertexArrays(1, &vertexArrayObject);
+    glBindVertexArray(vertexArrayObject);
+
+    // The buffers are only referenced, the index buffer binding is part of the vertex array object.
+    glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
+    setVertexAttributes();
+    if (indexBuffer != 0) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return vertexArrayObject;
+}
+
+void Drawable::setVertexAttributes() {
+    // Position at index '0', full precision floats.
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void *>(offsetof(Vertex, position)));
+    glEnableVertexAttribArray(0);
+    // Normal at index '1', packed signed normalized 10_10_10_2, the fourth component is unused.
+    glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(Vertex),
+                          reinterpret_cast<void *>(offsetof(Vertex, normal)));
+    glEnableVertexAttribArray(1);
+    // Texture coordinates at index '2', half floats.
+    glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<void *>(offsetof(Vertex, textureCoordinate)));
+    glEnableVertexAttribArray(2);
 }
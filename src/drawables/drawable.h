@@ -2,10 +2,15 @@
 #define DRAWABLE_H
 
 #include <QOpenGLFunctions_4_1_Core>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "glm/ext/matrix_float4x4.hpp"
 #include "glm/ext/vector_float3.hpp"
+#include "src/drawables/shaderProgram.h"
+#include "src/drawables/textureCache.h"
+#include "src/utils/vertex.h"
 
 class Drawable : protected QOpenGLFunctions_4_1_Core {
    public:
@@ -22,19 +27,23 @@ class Drawable : protected QOpenGLFunctions_4_1_Core {
     virtual void init();
 
     /**
-     * @brief update the drawable.
-     * @param elapsedTimeMs The elapsed time since the last update in ms
+     * @brief advance the simulation of the drawable by one fixed step, keeping the state of the previous step.
+     * @param stepMs The length of the simulation step in ms
+     */
+    virtual void simulate(float stepMs) {}
+
+    /**
+     * @brief update the drawable for rendering, blending the previous and the current simulation step.
+     * @param interpolation The progress from the previous to the current simulation step in [0, 1]
      * @param modelViewMatrix the mode view matrix of the parent object
      */
-    virtual void update(float elapsedTimeMs, glm::mat4 modelViewMatrix) {}
+    virtual void update(float interpolation, glm::mat4 modelViewMatrix) {}
 
     /**
      * @brief draw the drawable.
-     * @param projectionMatrix - transformation into NDC.
-     * @param lightPositions - array holding the light positions.
-     * @param moonDirection - direction to the moon.
+     * The projection, lights and moon direction are read from the FrameData uniform block.
      */
-    virtual void draw(glm::mat4 projectionMatrix, GLfloat lightPositions[], glm::vec3 moonDirection) {}
+    virtual void draw() {}
 
     /**
      * @brief Compile a shader and print warnings/errors if necessary.
@@ -44,6 +53,14 @@ class Drawable : protected QOpenGLFunctions_4_1_Core {
      */
     virtual GLuint compileShader(GLenum type, const std::string& path);
 
+    /**
+     * @brief Replaces every '#include "file"' line of a shader with the content of the file.
+     * @param source - the source of the shader.
+     * @param directory - the directory of the shader, includes are resolved relative to it.
+     * @return the source with all includes resolved, includes are not resolved recursively.
+     */
+    static QString resolveIncludes(const QString& source, const QString& directory);
+
     /**
      * @brief Link the shader program 'prg' and print warnings/errors if necessary.
      * @param program - the program
@@ -52,19 +69,75 @@ class Drawable : protected QOpenGLFunctions_4_1_Core {
     virtual GLuint linkProgram(GLuint program);
 
     /**
-     * @brief Loads an image as a texture from a given path.
+     * @brief Compiles and links a program and resolves the locations of its uniforms.
+     * Drawables loading the same shaders share a single program through the ShaderProgramCache.
+     * @param vertexShaderPath - string holding the location of the vertex shader.
+     * @param fragmentShaderPath - string holding the location of the fragment shader.
+     */
+    void loadProgram(const std::string& vertexShaderPath, const std::string& fragmentShaderPath);
+
+    /**
+     * @brief Returns the location of a uniform of the loaded program, warns if it does not exist.
+     * @param name - the name of the uniform.
+     * @return the location of the uniform or -1.
+     */
+    GLint uniformLocation(const std::string& name) const { return _shaderProgram->uniformLocation(name); }
+
+    /**
+     * @brief Loads an image as a texture from a given path, drawables loading the same image and type share it.
      * @param path the path to the texture.
      * @param type the way the texture shall be parsed
-     * @return the GLuint pointing to the texture.
+     * @return the shared texture, deleted once the last user releases it.
      */
-    GLuint loadTexture(std::string path, TextureType type = SRGB);
+    std::shared_ptr<Texture> loadTexture(std::string path, TextureType type = SRGB);
+
+    /**
+     * @brief Uploads interleaved vertices and optional indices into a new vertex array object.
+     * @param vertices the vertices in the shared vertex layout.
+     * @param vertexAmount the amount of vertices.
+     * @param indexData the raw index data or nullptr if the geometry is drawn without indices.
+     * @param indexDataSize the size of the index data in bytes.
+     * @param vertexBuffer receives the vertex buffer to be deleted by the caller, if null the buffer is deleted
+     * together with the vertex array object.
+     * @param indexBuffer receives the index buffer like the vertex buffer, 0 without indices.
+     * @return the handle of the vertex array object.
+     */
+    GLuint createVertexArray(const Vertex* vertices, size_t vertexAmount, const void* indexData = nullptr,
+                             GLsizeiptr indexDataSize = 0, GLuint* vertexBuffer = nullptr,
+                             GLuint* indexBuffer = nullptr);
+
+    /**
+     * @brief Uploads interleaved vertices and optional indices into a new vertex array object.
+     * @param vertices the vertices in the shared vertex layout.
+     * @param indexData the raw index data or nullptr if the geometry is drawn without indices.
+     * @param indexDataSize the size of the index data in bytes.
+     * @return the handle of the vertex array object.
+     */
+    GLuint createVertexArray(const std::vector<Vertex>& vertices, const void* indexData = nullptr,
+                             GLsizeiptr indexDataSize = 0) {
+        return createVertexArray(vertices.data(), vertices.size(), indexData, indexDataSize);
+    }
+
+    /**
+     * @brief Creates a new vertex array object reading the buffers of another one, e.g. to add instance attributes.
+     * @param vertexBuffer the buffer holding the interleaved vertices in the shared vertex layout.
+     * @param indexBuffer the buffer holding the indices or 0 if the geometry is drawn without indices.
+     * @return the handle of the vertex array object, left bound to add further attributes.
+     */
+    GLuint createSharedVertexArray(GLuint vertexBuffer, GLuint indexBuffer);
 
    protected:
-    glm::mat4 _modelViewMatrix;  /**< The model view matrix to get the object into model view space */
-    GLuint _program;             /**< The opengl program handling the shaders */
-    GLuint _vertexArrayObject;   /**< The vertex array object containing the vertices */
-    std::string _texturePath;    /**< Path to the texture */
-    unsigned int _textureHandle; /**< Handle of the texture */
+    /**
+     * @brief Points the attributes of the shared vertex layout at the bound array buffer.
+     */
+    void setVertexAttributes();
+
+    glm::mat4 _modelViewMatrix;                    /**< The model view matrix to get the object into model view space */
+    GLuint _program;                               /**< The opengl program handling the shaders */
+    std::shared_ptr<ShaderProgram> _shaderProgram; /**< The program together with its uniform locations */
+    GLuint _vertexArrayObject;                     /**< The vertex array object containing the vertices */
+    std::string _texturePath;                      /**< Path to the texture */
+    unsigned int _textureHandle;                   /**< Handle of the texture */
 };
 
 #endif  // DRAWABLE_H
@@ -1,6 +1,7 @@
 #include <memory>
 #include <vector>
 
+#include "glm/common.hpp"
 #include "glm/ext/vector_float3.hpp"
 #include "glm/fwd.hpp"
 #include "glm/trigonometric.hpp"
@@ -15,14 +16,8 @@
 #include "src/drawables/drawable.h"
 #include "src/drawables/fishController.h"
 
-FishController::FishController(const std::shared_ptr<FloppyMesh>& billMesh)
-    : Drawable(),
-      _height(0.08f),
-      _width(0.25f),
-      _verticalVelocity(0.0f),
-      _position(glm::vec3(0.0f)),
-      _hitboxColour(glm::vec3(0.1f, 0.4f, 0.9f)),
-      _billMesh(billMesh) {}
+FishController::FishController(const FishState& fish, const std::shared_ptr<FloppyMesh>& billMesh)
+    : Drawable(), _fish(fish), _hitboxColour(glm::vec3(0.1f, 0.4f, 0.9f)), _billMesh(billMesh) {}
 FishController::~FishController() {}
 
 void FishController::init() {
@@ -32,78 +27,51 @@ void FishController::init() {
     // Initialize OpenGL functions.
     Drawable::init();
 
-    // Create a program for this class.
-    _program = glCreateProgram();
-
-    // Compile shader.
-    GLuint vs = compileShader(GL_VERTEX_SHADER, "src/shaders/hitbox.vs.glsl");
-    GLuint fs = compileShader(GL_FRAGMENT_SHADER, "src/shaders/hitbox.fs.glsl");
-
-    // Attach shader to the program.
-    glAttachShader(_program, vs);
-    glAttachShader(_program, fs);
-
-    // Link program.
-    _program = linkProgram(_program);
-
-    // Set up a vertex array object for the geometry.
-    if (_vertexArrayObject == 0) {
-        glGenVertexArrays(1, &_vertexArrayObject);
-    }
-    glBindVertexArray(_vertexArrayObject);
-
-    // Fill position buffer with data.
-    std::vector<glm::vec3> positions = {
-        glm::vec3(-1, -1, 0), glm::vec3(1, 1, 0),  glm::vec3(-1, 1, 0),
-        glm::vec3(-1, -1, 0), glm::vec3(1, -1, 0), glm::vec3(1, 1, 0),
+    // Load the shared program and look up its uniforms once.
+    loadProgram("src/shaders/hitbox.vs.glsl", "src/shaders/hitbox.fs.glsl");
+    _uniforms.modelViewMatrix = uniformLocation("modelview_matrix");
+    _uniforms.hitboxColour = uniformLocation("hitboxColour");
+
+    // Fill the vertices of the hitbox quad, only the positions are used.
+    std::vector<Vertex> vertices = {
+        Vertex(glm::vec3(-1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(-1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(-1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
     };
-    GLuint position_buffer;
-    glGenBuffers(1, &position_buffer);
-    glBindBuffer(GL_ARRAY_BUFFER, position_buffer);
-    glBufferData(GL_ARRAY_BUFFER, positions.size() * 3 * sizeof(float), positions.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(0);
 
-    // Unbind vertex array object.
-    glBindVertexArray(0);
-
-    // Delete buffers (the data is stored in the vertex array object).
-    glDeleteBuffers(1, &position_buffer);
-
-    // Unbind vertex array object.
-    glBindVertexArray(0);
+    // Set up a vertex array object for the geometry.
+    _vertexArrayObject = createVertexArray(vertices);
 }
 
-void FishController::update(float elapsedTimeMs, glm::mat4 modelViewMatrix) {
-    // Slowly revert velocity back to lower velocity bound.
-    if (_verticalVelocity >= Config::velocityBound) {
-        _verticalVelocity += Config::verticalAcceleration;
-    }
+void FishController::update(float interpolation, glm::mat4 modelViewMatrix) {
+    // Blend the previous and the current simulation step.
+    glm::vec3 position = glm::mix(_fish.previousPosition(), _fish.position(), interpolation);
+    float verticalVelocity = glm::mix(_fish.previousVerticalVelocity(), _fish.verticalVelocity(), interpolation);
 
-    // Update y-coordinate with the current velocity.
-    _position.y += _verticalVelocity;
-
-    // Translate to the updated y-coordinate.
-    _modelViewMatrix = translate(modelViewMatrix, glm::vec3(_position.x, _position.y, 0));
+    // Translate to the interpolated y-coordinate.
+    _modelViewMatrix = translate(modelViewMatrix, glm::vec3(position.x, position.y, 0));
 
     // Let's do a simple linear interpolation to translate between current velocity and the angle.
     // Maps from [velocityBound, verticalVelocity] to [lowerAngle, upperAngle].
-    float x0 = Config::velocityBound, x1 = Config::verticalVelocity, x = _verticalVelocity;
+    float x0 = Config::velocityBound, x1 = Config::verticalVelocity, x = verticalVelocity;
     float f0 = Config::lowerAngle, f1 = Config::upperAngle;
     float rotation = f0 * ((x1 - x) / (x1 - x0)) + f1 * ((x - x0) / (x1 - x0));
     _modelViewMatrix = glm::rotate(_modelViewMatrix, glm::radians(rotation), glm::vec3(0, 0, 1));
 
     // Update mesh before scaling the hitbox.
-    _billMesh->update(elapsedTimeMs, _modelViewMatrix);
+    _billMesh->update(interpolation, _modelViewMatrix);
 
     // Apply the scaling of the hitbox quad.
-    _modelViewMatrix = scale(_modelViewMatrix, glm::vec3(_width, _height, 1.0));
+    _modelViewMatrix = scale(_modelViewMatrix, glm::vec3(_fish.width(), _fish.height(), 1.0));
 }
 
-void FishController::draw(glm::mat4 projectionMatrix, GLfloat lightPositions[], glm::vec3 moonDirection) {
+void FishController::draw() {
     // Draw the mesh.
     if (_billMesh != nullptr) {
-        _billMesh->draw(projectionMatrix, lightPositions, moonDirection);
+        _billMesh->draw();
     }
 
     // Only draw the hitbox quad if the debug-flag is enabled.
@@ -120,11 +88,8 @@ void FishController::draw(glm::mat4 projectionMatrix, GLfloat lightPositions[],
         glBindVertexArray(_vertexArrayObject);
 
         // Set parameters.
-        glUniformMatrix4fv(glGetUniformLocation(_program, "projection_matrix"), 1, GL_FALSE,
-                           glm::value_ptr(projectionMatrix));
-        glUniformMatrix4fv(glGetUniformLocation(_program, "modelview_matrix"), 1, GL_FALSE,
-                           glm::value_ptr(_modelViewMatrix));
-        glUniform3fv(glGetUniformLocation(_program, "hitboxColour"), 1, value_ptr(_hitboxColour));
+        glUniformMatrix4fv(_uniforms.modelViewMatrix, 1, GL_FALSE, glm::value_ptr(_modelViewMatrix));
+        glUniform3fv(_uniforms.hitboxColour, 1, value_ptr(_hitboxColour));
 
         // Call draw.
         glDrawArrays(GL_TRIANGLE_FAN, 0, 6);
@@ -133,10 +98,3 @@ void FishController::draw(glm::mat4 projectionMatrix, GLfloat lightPositions[],
         glBindVertexArray(0);
     }
 }
-
-void FishController::getBounds(float& boundX, float& boundY, float& boundWidth, float& boundHeight) const {
-    boundX = _position.x;
-    boundY = _position.y;
-    boundWidth = _width;
-    boundHeight = _height;
-}
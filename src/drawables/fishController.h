@@ -5,56 +5,50 @@
 #include "glm/ext/matrix_float4x4.hpp"
 #include "glm/ext/vector_float3.hpp"
 #include "src/config/config.h"
+#include "src/core/fishState.h"
 #include "src/drawables/drawable.h"
 
 class FishController : public Drawable {
    public:
-    FishController(const std::shared_ptr<FloppyMesh>& billMesh);
+    /**
+     * @param fish The simulated state of the fish, only read for rendering.
+     * @param billMesh The mesh of the fish.
+     */
+    FishController(const FishState& fish, const std::shared_ptr<FloppyMesh>& billMesh);
     ~FishController() override;
 
-    void flop() { _verticalVelocity = Config::verticalVelocity; }
-
-    glm::vec3 position() const { return _position; }
-    float height() { return _height; }
-    float width() { return _width; }
-
     /**
      * Initialize the fish.
      */
     void init() override;
 
     /**
-     * Update the fish.
-     * @param elapsedTimeMs - elapsed time since the last update in ms.
-     * @param modelViewMatrix - transformation into view coordinates.
+     * Advance the animation of the mesh by one simulation step, the fish itself is simulated by the game state.
+     * @param stepMs - length of the simulation step in ms.
      */
-    void update(float elapsedTimeMs, glm::mat4 modelViewMatrix) override;
+    void simulate(float stepMs) override { _billMesh->simulate(stepMs); }
 
     /**
-     * Draw the fish.
-     * @param projectionMatrix - transformation into NDC.
-     * @param lightPositions - array holding the light positions.
-     * @param moonDirection - vector holding the moon direction.
+     * Update the fish for rendering.
+     * @param interpolation - progress from the previous to the current simulation step in [0, 1].
+     * @param modelViewMatrix - transformation into view coordinates.
      */
-    void draw(glm::mat4 projectionMatrix, GLfloat lightPositions[], glm::vec3 moonDirection) override;
+    void update(float interpolation, glm::mat4 modelViewMatrix) override;
 
     /**
-     * @brief Get the bounding box of the fish.
-     * @param boundX - the x-coordinate of the fish.
-     * @param boundY - the y-coordinate of the fish.
-     * @param boundWidth - the width of the fish.
-     * @param boundHeight - the height of the fish.
-     * @returns the coordinates and dimensions of the fish.
+     * Draw the fish.
      */
-    void getBounds(float& boundX, float& boundY, float& boundWidth, float& boundHeight) const;
+    void draw() override;
 
    private:
-    float _height;                         /**< Height of the fish. */
-    float _width;                          /**< Width of the fish. */
-    float _verticalVelocity;               /**< The current velocity of the fish. */
-    glm::vec3 _position;                   /**< Current positons of the fish. */
+    const FishState& _fish;                /**< The simulated state of the fish. */
     glm::vec3 _hitboxColour;               /**< The colour of the hitbox. */
     std::shared_ptr<FloppyMesh> _billMesh; /**< Pointer to the mesh of Bill */
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint modelViewMatrix; /**< Location of the model view matrix. */
+        GLint hitboxColour;    /**< Location of the hitbox colour. */
+    } _uniforms;
 };
 
 #endif  // FISH_H
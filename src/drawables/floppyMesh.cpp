@@ -5,264 +5,228 @@
 #define GLM_ENABLE_EXPERIMENTAL
 
 #include <QFile>
+#include <QFileInfo>
 #include <QOpenGLShaderProgram>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "glm/common.hpp"
 #include "glm/ext/vector_float3.hpp"
 #include "glm/fwd.hpp"
 #include "glm/gtx/rotate_vector.hpp"
-#include "lib/tinyobj/tiny_obj_loader.h"
 #include "src/config/config.h"
 #include "src/drawables/floppyMesh.h"
+#include "src/drawables/lightGrid.h"
+#include "src/drawables/meshCache.h"
+#include "src/utils/bakedMesh.h"
+#include "src/utils/meshLoader.h"
 #include "src/utils/utils.h"
 
 // Main constructors.
 FloppyMesh::FloppyMesh(std::string meshPath, glm::vec3 initialTranslation, float initialScale, float initialRotation,
                        float subsequentRotationSpeed)
     : _meshPath(std::move(meshPath)),
-      _meshIndex(0),
       _initialTranslation(initialTranslation),
       _initialScale(initialScale),
       _initialRotation(initialRotation),
-      _subsequentRotationSpeed(subsequentRotationSpeed){}
+      _subsequentRotation(0.0f),
+      _previousSubsequentRotation(0.0f),
+      _subsequentRotationSpeed(subsequentRotationSpeed) {}
 
 FloppyMesh::FloppyMesh(std::string meshPath, float initialScale, float initialRotation)
-    : _meshPath(std::move(meshPath)), _meshIndex(0), _initialScale(initialScale), _initialRotation(initialRotation) {}
+    : _meshPath(std::move(meshPath)),
+      _initialTranslation(0.0f),
+      _initialScale(initialScale),
+      _initialRotation(initialRotation),
+      _subsequentRotation(0.0f),
+      _previousSubsequentRotation(0.0f),
+      _subsequentRotationSpeed(0.0f) {}
 
 FloppyMesh::~FloppyMesh() = default;
 
-// Constructor for next mesh parts.
-FloppyMesh::FloppyMesh(std::string meshPath, uint meshIndex) {
-    _meshPath = std::move(meshPath);
-    _meshIndex = meshIndex;
-    // Set the scale to 1.0f, so it will keep the parent's transformation.
-    _initialScale = 1.0f;
-}
-
 void FloppyMesh::init() {
     // Initialize OpenGL funtions, replacing glewInit().
     initializeOpenGLFunctions();
 
-    // Create a program for this class.
-    _program = glCreateProgram();
+    // Load the shared program and look up its uniforms once.
+    loadProgram("src/shaders/cookTorrance.vs.glsl", "src/shaders/cookTorrance.fs.glsl");
+    _uniforms.modelViewMatrix = uniformLocation("modelview_matrix");
+    loadMaterialUniforms();
 
-    // Compile shader.
-    GLuint vs = compileShader(GL_VERTEX_SHADER, "src/shaders/cookTorrance.vs.glsl");
-    GLuint fs = compileShader(GL_FRAGMENT_SHADER, "src/shaders/cookTorrance.fs.glsl");
-
-    // Attach shader to the program.
-    glAttachShader(_program, vs);
-    glAttachShader(_program, fs);
-
-    // Link program.
-    _program = linkProgram(_program);
+    // Retrieve the shared geometry and materials.
+    loadMesh();
+}
 
-    // Create mesh vectors (dynamic arrays).
-    std::vector<glm::vec3> positions;
-    std::vector<glm::vec3> normals;
-    std::vector<glm::vec2> textureCoordinates;
-    std::vector<GLuint> indices;
+void FloppyMesh::loadMaterialUniforms() {
+    _uniforms.eta = uniformLocation("eta");
+    _uniforms.albedo = uniformLocation("albedo");
+    _uniforms.roughness = uniformLocation("roughness");
+    _uniforms.transparency = uniformLocation("transparency");
+    _uniforms.emissiveColour = uniformLocation("emissiveColour");
 
-    uint amountMeshParts = 0;
+    // The textures of the light grid always stay bound to their units, thus the samplers are only set once.
+    glUseProgram(_program);
+    glUniform1i(uniformLocation("light_data"), LightGrid::lightTextureUnit);
+    glUniform1i(uniformLocation("light_tiles"), LightGrid::tileTextureUnit);
+    glUniform1i(uniformLocation("light_indices"), LightGrid::indexTextureUnit);
+    glUseProgram(0);
+}
 
-    // Load mesh.
-    loadObj(_meshPath, _meshIndex, positions, normals, textureCoordinates, indices, _textureName, _shininess,
-            _transparency, _emissiveColour, amountMeshParts);
+void FloppyMesh::loadMesh() {
+    // Only load and upload the mesh if no other mesh did so before, a mesh that failed to load is not cached.
+    _mesh = MeshCache::find(_meshPath);
+    if (_mesh == nullptr) {
+        _mesh = createMesh();
+        if (_mesh != nullptr) {
+            MeshCache::insert(_meshPath, _mesh);
+        }
+    }
+}
 
-    // If the current index is lower than the maximum, attach and initialize a child / subsequent mesh part.
-    if (_meshIndex < amountMeshParts - 1) {
-        // Initialize the next mesh.
-        _nextMeshPart = std::make_shared<FloppyMesh>(_meshPath, _meshIndex + 1);
-        _nextMeshPart->init();
+std::shared_ptr<Mesh> FloppyMesh::createMesh() {
+    auto mesh = std::make_shared<Mesh>();
+    std::vector<MeshRange> ranges;
+    size_t vertexAmount = 0;
+    size_t indexSize = 0;
+    unsigned int cornerAmount = 0;
+
+    // Prefer the baked blob if it is at least as new as the obj, its vertices and indices are uploaded straight from
+    // the memory mapped file.
+    QString bakedPath = QString::fromStdString(BakedMesh::pathFor(_meshPath));
+    QFileInfo bakedInfo(bakedPath);
+    QFileInfo objInfo(QString::fromStdString(_meshPath));
+    QFile bakedFile(bakedPath);
+    uchar* bakedData = nullptr;
+    if (bakedInfo.exists() && bakedInfo.lastModified() >= objInfo.lastModified() && bakedFile.open(QFile::ReadOnly)) {
+        bakedData = bakedFile.map(0, bakedFile.size());
     }
 
-    _verticeAmount = indices.size();
+    BakedMesh::View bakedMesh;
+    const bool fromBlob = bakedData != nullptr && BakedMesh::read(bakedData, bakedFile.size(), bakedMesh);
+    if (fromBlob) {
+        // Set up a vertex array object for the geometry of all parts.
+        mesh->vertexArrayObject = createVertexArray(bakedMesh.vertices, bakedMesh.vertexAmount, bakedMesh.indices,
+                                                    bakedMesh.indexSize, &mesh->vertexBuffer, &mesh->indexBuffer);
+        ranges = std::move(bakedMesh.parts);
+        vertexAmount = bakedMesh.vertexAmount;
+        indexSize = bakedMesh.indexSize;
+        cornerAmount = bakedMesh.cornerAmount;
+    } else {
+        // Fall back to parsing all parts of the obj at once.
+        MeshData meshData;
+        if (!MeshLoader::loadObj(_meshPath, meshData)) {
+            qDebug() << "Cannot load" << _meshPath.c_str() << "the mesh is not drawn.";
+            if (bakedData != nullptr) {
+                bakedFile.unmap(bakedData);
+            }
+            return nullptr;
+        }
+
+        // Set up a vertex array object for the geometry of all parts.
+        mesh->vertexArrayObject =
+            createVertexArray(meshData.vertices.data(), meshData.vertices.size(), meshData.indices.data(),
+                              meshData.indices.size(), &mesh->vertexBuffer, &mesh->indexBuffer);
+        ranges = std::move(meshData.parts);
+        vertexAmount = meshData.vertices.size();
+        indexSize = meshData.indices.size();
+        cornerAmount = meshData.cornerAmount;
+    }
 
-    // Set up a vertex array object for the geometry.
-    if (_vertexArrayObject == 0) {
-        glGenVertexArrays(1, &_vertexArrayObject);
+    // The data was copied into the buffers, release the mapping.
+    if (bakedData != nullptr) {
+        bakedFile.unmap(bakedData);
     }
-    glBindVertexArray(_vertexArrayObject);
-
-    // Fill vertex array object with data.
-    GLuint positionBuffer;
-    glGenBuffers(1, &positionBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, positionBuffer);
-    glBufferData(GL_ARRAY_BUFFER, positions.size() * 3 * sizeof(float), positions.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-    glEnableVertexAttribArray(0);
-
-    GLuint normalBuffer;
-    glGenBuffers(1, &normalBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, normalBuffer);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * 3 * sizeof(float), normals.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-    glEnableVertexAttribArray(1);
-
-    GLuint textureCoordinateBuffer;
-    glGenBuffers(1, &textureCoordinateBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, textureCoordinateBuffer);
-    // Multiply with 2, as it is only vec2.
-    glBufferData(GL_ARRAY_BUFFER, textureCoordinates.size() * 2 * sizeof(float), textureCoordinates.data(),
-                 GL_STATIC_DRAW);
-    // Use indices of 2.
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
-    glEnableVertexAttribArray(2);
-
-    GLuint indexBuffer;
-    glGenBuffers(1, &indexBuffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
 
-    // Unbind vertex array object.
-    glBindVertexArray(0);
+    // Set up the ranges and materials of the parts, parts using the same image share its texture.
+    for (const MeshRange& range : ranges) {
+        MeshPart part;
+        part.baseVertex = range.baseVertex;
+        part.indexOffset = range.indexOffset;
+        part.indexAmount = range.indexAmount;
+        part.indexType = range.indexSize == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        part.texture = loadTexture("res/" + range.material.textureName);
+        part.shininess = range.material.shininess;
+        part.transparency = range.material.transparency;
+        part.emissiveColour = range.material.emissiveColour;
+        mesh->parts.push_back(part);
+    }
 
-    // Delete buffers (the data is stored in the vertex array object).
-    glDeleteBuffers(1, &positionBuffer);
-    glDeleteBuffers(1, &normalBuffer);
-    glDeleteBuffers(1, &textureCoordinateBuffer);
-    glDeleteBuffers(1, &indexBuffer);
+    // Compare against one full precision, non-interleaved vertex and one 32-bit index per face corner.
+    size_t unpackedBytes = cornerAmount * (8 * sizeof(float) + sizeof(GLuint));
+    size_t packedBytes = vertexAmount * sizeof(Vertex) + indexSize;
+    qDebug() << "Loaded" << _meshPath << (fromBlob ? "from its baked blob" : "from the obj") << "with"
+             << vertexAmount << "vertices from" << cornerAmount << "face corners," << unpackedBytes << "->"
+             << packedBytes << "bytes.";
 
-    // Load texture.
-    _textureHandle = loadTexture("res/" + _textureName);
+    return mesh;
 }
 
-void FloppyMesh::draw(glm::mat4 projectionMatrix, GLfloat lightPositions[], glm::vec3 moonDirection) {
-    if (_program == 0) {
-        qDebug() << "Program not initialized.";
+void FloppyMesh::draw() {
+    if (_program == 0 || _mesh == nullptr) {
+        qDebug() << "Program or mesh not initialized.";
         return;
     }
 
-    // Draw next mesh part first if it exists.
-    if (_nextMeshPart != nullptr) {
-        _nextMeshPart->draw(projectionMatrix, lightPositions, moonDirection);
-    }
-
     // Load program.
     glUseProgram(_program);
     glCheckError();
 
     // Bind vertex array object.
-    glBindVertexArray(_vertexArrayObject);
+    glBindVertexArray(_mesh->vertexArrayObject);
     glCheckError();
 
-    // Set uniform variables.
+    // Set uniform variables, the projection and lighting come from the FrameData block.
     // Set matrix parameters.
-    glUniformMatrix4fv(glGetUniformLocation(_program, "projection_matrix"), 1, GL_FALSE,
-                       glm::value_ptr(projectionMatrix));
-    glUniformMatrix4fv(glGetUniformLocation(_program, "modelview_matrix"), 1, GL_FALSE,
-                       glm::value_ptr(_modelViewMatrix));
+    glUniformMatrix4fv(_uniforms.modelViewMatrix, 1, GL_FALSE, glm::value_ptr(_modelViewMatrix));
+
+    // Draw a single instance.
+    drawParts(1);
+}
 
+void FloppyMesh::drawParts(GLsizei instanceAmount) {
     // Set lighting parameters.
-    glUniform1f(glGetUniformLocation(_program, "eta"), Config::indexOfRefraction);
-    // Map shininess [0,1000] to roughness [0,1].
-    float roughness = 0.000001f * pow(_shininess - 1000, 2.0f);
-    glUniform1f(glGetUniformLocation(_program, "roughness"), roughness);
-    glUniform1f(glGetUniformLocation(_program, "transparency"), _transparency);
-    glUniform3fv(glGetUniformLocation(_program, "emissiveColour"), 1, value_ptr(_emissiveColour));
-    glUniform3fv(glGetUniformLocation(_program, "moon_direction"), 1, value_ptr(moonDirection));
-
-    // Push the light positions into an array, then set it in the shader.
-    glUniform3fv(glGetUniformLocation(_program, "light_position"), 6, lightPositions);
-
-    // Set the background texture.
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, _textureHandle);
-    glUniform1i(glGetUniformLocation(_program, "albedo"), 0);
+    glUniform1f(_uniforms.eta, Config::indexOfRefraction);
 
-    // Call draw.
-    glDrawElements(GL_TRIANGLES, _verticeAmount, GL_UNSIGNED_INT, 0);
-    glCheckError();
+    // Set the background texture unit.
+    glActiveTexture(GL_TEXTURE0);
+    glUniform1i(_uniforms.albedo, 0);
+
+    // Draw the parts back to front, the last part of the mesh first.
+    for (auto part = _mesh->parts.rbegin(); part != _mesh->parts.rend(); ++part) {
+        // Set the material of the part.
+        // Map shininess [0,1000] to roughness [0,1].
+        float roughness = 0.000001f * pow(part->shininess - 1000, 2.0f);
+        glUniform1f(_uniforms.roughness, roughness);
+        glUniform1f(_uniforms.transparency, part->transparency);
+        glUniform3fv(_uniforms.emissiveColour, 1, value_ptr(part->emissiveColour));
+        glBindTexture(GL_TEXTURE_2D, part->texture->handle);
+
+        // Call draw.
+        glDrawElementsInstancedBaseVertex(GL_TRIANGLES, part->indexAmount, part->indexType,
+                                          reinterpret_cast<void*>(static_cast<uintptr_t>(part->indexOffset)),
+                                          instanceAmount, part->baseVertex);
+        glCheckError();
+    }
 
     // Unbind vertex array object.
     glBindVertexArray(0);
     glCheckError();
 }
 
-bool FloppyMesh::loadObj(const std::string& filename, uint partIndex, std::vector<glm::vec3>& positions,
-                         std::vector<glm::vec3>& normals, std::vector<glm::vec2>& textureCoordinates,
-                         std::vector<unsigned int>& indices, std::string& textureName, float& shininess,
-                         float& transparency, glm::vec3& emissiveColour, uint& amountMeshParts) {
-    positions.clear();
-    normals.clear();
-    textureCoordinates.clear();
-    indices.clear();
-
-    // Use V2 API of tiny obj loader.
-    // Create config for loading.
-    tinyobj::ObjReaderConfig objReaderConfig = tinyobj::ObjReaderConfig();
-    // Disable vertex colour.
-    objReaderConfig.vertex_color = false;
-
-    // Parse the file.
-    auto objReader = tinyobj::ObjReader();
-    if (!objReader.ParseFromFile(filename, objReaderConfig)) {
-        fprintf(stderr, "%s\n", objReader.Error().c_str());
-        return false;
-    }
-
-    // Retrieve vectors from mesh.
-    std::vector<tinyobj::shape_t> shapes = objReader.GetShapes();
-    if (objReader.GetShapes().empty()) {
-        fprintf(stderr, "%s: cannot understand data\n", filename.c_str());
-        return false;
-    }
-    amountMeshParts = shapes.size();
-    tinyobj::attrib_t attributes = objReader.GetAttrib();
-    std::vector<tinyobj::material_t> materials = objReader.GetMaterials();
-
-    bool have_normals = (attributes.normals.size() / 3 == attributes.vertices.size() / 3);
-    bool have_texcoords = (attributes.texcoords.size() / 2 == attributes.vertices.size());
-
-    // Validate.
-    if (attributes.vertices.empty() || attributes.vertices.size() % 3 != 0 || attributes.normals.size() % 3 != 0 ||
-        (have_normals && attributes.normals.size() / 3 != attributes.vertices.size() / 3) ||
-        attributes.texcoords.size() % 2 != 0 ||
-        (have_texcoords && attributes.texcoords.size() / 2 != attributes.vertices.size()) ||
-        shapes[partIndex].mesh.indices.empty() || shapes[partIndex].mesh.indices.size() % 3 != 0) {
-        positions.clear();
-        normals.clear();
-        textureCoordinates.clear();
-        indices.clear();
-        fprintf(stderr, "%s: cannot understand data\n", filename.c_str());
-        return false;
-    }
-
-    // Indices.
-    uint vertPosition = 0;
-    uint vertNormal = 0;
-    uint vertTexCoord = 0;
-
-    for (size_t i = 0; i < shapes[partIndex].mesh.indices.size(); i++) {
-        vertPosition = shapes[partIndex].mesh.indices[i].vertex_index;
-        vertNormal = shapes[partIndex].mesh.indices[i].normal_index;
-        vertTexCoord = shapes[partIndex].mesh.indices[i].texcoord_index;
-        positions.emplace_back(attributes.vertices[3 * vertPosition + 0], attributes.vertices[3 * vertPosition + 1],
-                               attributes.vertices[3 * vertPosition + 2]);
-        normals.emplace_back(attributes.normals[3 * vertNormal + 0], attributes.normals[3 * vertNormal + 1],
-                             attributes.normals[3 * vertNormal + 2]);
-        textureCoordinates.emplace_back(attributes.texcoords[2 * vertTexCoord + 0],
-                                        attributes.texcoords[2 * vertTexCoord + 1]);
-        indices.push_back(i);
+void FloppyMesh::simulate(float stepMs) {
+    if (_subsequentRotationSpeed > 0.0f) {
+        // Rotate around Y for debug reasons, wrapping both steps keeps the interpolation between them continuous.
+        _previousSubsequentRotation = _subsequentRotation;
+        _subsequentRotation += _subsequentRotationSpeed * stepMs;
+        if (_subsequentRotation >= 360.0f) {
+            _subsequentRotation -= 360.0f;
+            _previousSubsequentRotation -= 360.0f;
+        }
     }
-
-    // Set material properties.
-    // Assume each mesh part has a distinct material, i.e. no other face has a different material.
-    int materialIndex = shapes[partIndex].mesh.material_ids[0];
-    textureName = materialIndex >= 0 ? materials[materialIndex].diffuse_texname : "";
-    shininess = materialIndex >= 0 ? materials[materialIndex].shininess : 0.5f;
-    transparency = materialIndex >= 0 ? materials[materialIndex].dissolve : 1.0f;
-    emissiveColour = materialIndex >= 0
-                         ? glm::vec3(materials[materialIndex].emission[0], materials[materialIndex].emission[1],
-                                     materials[materialIndex].emission[2])
-                         : glm::vec3(0.0f);
-
-    return true;
 }
 
-void FloppyMesh::update(float elapsedTimeMs, glm::mat4 modelViewMatrix) {
+void FloppyMesh::update(float interpolation, glm::mat4 modelViewMatrix) {
     // Translations.
     modelViewMatrix = translate(modelViewMatrix, _initialTranslation);
 
@@ -273,14 +237,8 @@ void FloppyMesh::update(float elapsedTimeMs, glm::mat4 modelViewMatrix) {
     modelViewMatrix = rotate(modelViewMatrix, glm::radians(_initialRotation), glm::vec3(0.0f, 1.0f, 0.0f));
     if (_subsequentRotationSpeed > 0.0f) {
         // Rotate around Y for debug reasons.
-        _subsequentRotation += _subsequentRotationSpeed * elapsedTimeMs;
-        _subsequentRotation = _subsequentRotation >= 360.0f ? 0.0f : _subsequentRotation;
-        modelViewMatrix = rotate(modelViewMatrix, glm::radians(_subsequentRotation), glm::vec3(0.0f, 1.0f, 0.0f));
-    }
-
-    // Update the next mesh part if applicable.
-    if (_nextMeshPart != nullptr) {
-        _nextMeshPart->update(elapsedTimeMs, modelViewMatrix);
+        float rotation = glm::mix(_previousSubsequentRotation, _subsequentRotation, interpolation);
+        modelViewMatrix = rotate(modelViewMatrix, glm::radians(rotation), glm::vec3(0.0f, 1.0f, 0.0f));
     }
 
     _modelViewMatrix = modelViewMatrix;
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "drawable.h"
+#include "meshCache.h"
 #include "glm/ext/vector_float3.hpp"
 
 class FloppyMesh : public Drawable {
@@ -15,9 +16,6 @@ class FloppyMesh : public Drawable {
     /// Simplified constructor.
     FloppyMesh(std::string meshPath, float initialScale = 1.0f, float initialRotation = 0.0f);
 
-    /// Constructor for creating the next mesh part.
-    FloppyMesh(std::string meshPath, uint meshIndex);
-
     ~FloppyMesh() override;
 
     /**
@@ -25,20 +23,23 @@ class FloppyMesh : public Drawable {
      */
     void init() override;
 
+    /**
+     * @brief simulate Advances the subsequent rotation by one simulation step.
+     * @param stepMs The length of the simulation step in ms
+     */
+    void simulate(float stepMs) override;
+
     /**
      * @brief update Updates the object's position, rotation etc.
-     * @param elapsedTimeMs The elapsed time since the last update in ms
+     * @param interpolation The progress from the previous to the current simulation step in [0, 1]
      * @param modelViewMatrix the mode view matrix of the parent object
      */
-    void update(float elapsedTimeMs, glm::mat4 modelViewMatrix) override;
+    void update(float interpolation, glm::mat4 modelViewMatrix) override;
 
     /**
      * @brief draw the mesh.
-     * @param projectionMatrix - transformation into NDC.
-     * @param lightPositions - array holding the light positions.
-     * @param moonDirection - vector holding the moon direction.
      */
-    void draw(glm::mat4 projectionMatrix, GLfloat lightPositions[], glm::vec3 moonDirection) override;
+    void draw() override;
 
     /**
      * @brief re-sets the initial rotation of the mesh.
@@ -46,18 +47,26 @@ class FloppyMesh : public Drawable {
      */
     void setRotation(const float rotation) { _initialRotation = rotation; }
 
-   protected:
-    GLuint _verticeAmount;                     /**< The amount of vertices used to draw bill */
-    std::shared_ptr<FloppyMesh> _nextMeshPart; /**< The subsequent part of the mesh if it exists */
+    /**
+     * @brief Returns the model view matrix computed by the last update.
+     * @return the model view matrix of the mesh.
+     */
+    const glm::mat4& modelViewMatrix() const { return _modelViewMatrix; }
 
+   protected:
     // Mesh and material.
-    float _shininess;          /**< The shininess of the object. */
-    float _transparency;       /**< The transparency/dissolve/alpha of the object. */
-    GLuint _meshIndex;         /**< The part of mesh to render, will be used to recursively render each part */
-    GLuint _textureHandle;     /**< handle of the background texture */
-    std::string _meshPath;     /**< The filepath of the mesh. */
-    std::string _textureName;  /**< The name of the texture file. */
-    glm::vec3 _emissiveColour; /**< The colour of the emission of the object. */
+    std::string _meshPath;       /**< The filepath of the mesh. */
+    std::shared_ptr<Mesh> _mesh; /**< The shared geometry and materials of all parts of the mesh. */
+
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint modelViewMatrix; /**< Location of the model view matrix. */
+        GLint eta;             /**< Location of the index of refraction. */
+        GLint albedo;          /**< Location of the albedo texture unit. */
+        GLint roughness;       /**< Location of the roughness of the current part. */
+        GLint transparency;    /**< Location of the transparency of the current part. */
+        GLint emissiveColour;  /**< Location of the emissive colour of the current part. */
+    } _uniforms;
 
     // Transformations, initial and ongoing.
     glm::mat4 _modelViewMatrix;    /**< The model view matrix to get the object into model view space */
@@ -66,27 +75,32 @@ class FloppyMesh : public Drawable {
     float _initialRotation;        /**< The initial rotation around the Y-axis applied as a baseline to the mesh */
     /**< The subsequent rotation around the Y-axis applied to the mesh. Mostly for debugging */
     float _subsequentRotation;
+    /**< The subsequent rotation of the previous simulation step. */
+    float _previousSubsequentRotation;
     /**< The subsequent rotation speed around the Y-axis applied to the mesh. Mostly for debugging */
     float _subsequentRotationSpeed;
 
     /**
-     * @brief loadObj loads a mesh from a given path.
-     * @param filename the path to the obj.
-     * @param positions of the vertices.
-     * @param normals of said vertices.
-     * @param textureCoordinates of said vertices.
-     * @param indices of the vertices.
-     * @param textureName the name of the texture.
-     * @param shininess of the object.
-     * @param transparency of the object applied globally.
-     * @param emissiveColour of the object.
-     * @param amountMeshParts the amount of parts the mesh has.
-     * @return true if it was successful.
+     * @brief Loads all parts of the mesh and uploads their geometry and textures.
+     * @return the loaded mesh, ready to be shared through the MeshCache, nullptr if the mesh cannot be loaded.
+     */
+    std::shared_ptr<Mesh> createMesh();
+
+    /**
+     * @brief Looks up the material uniforms shared by all cook torrance programs and sets the light grid samplers.
+     */
+    void loadMaterialUniforms();
+
+    /**
+     * @brief Retrieves the mesh from the MeshCache, loads and caches it if no other mesh did so before.
+     */
+    void loadMesh();
+
+    /**
+     * @brief Draws all parts of the mesh, expects the program and vertex array object to be bound.
+     * @param instanceAmount - the amount of instances to draw of every part.
      */
-    bool loadObj(const std::string& filename, uint partIndex, std::vector<glm::vec3>& positions,
-                 std::vector<glm::vec3>& normals, std::vector<glm::vec2>& textureCoordinates,
-                 std::vector<unsigned int>& indices, std::string& textureName, float& shininess, float& transparency,
-                 glm::vec3& emissiveColour, uint& amountMeshParts);
+    void drawParts(GLsizei instanceAmount);
 };
 
 #endif  // FLOPPY_MESH_H
@@ -0,0 +1,31 @@
+#include "src/drawables/frameUniforms.h"
+
+#include "src/utils/utils.h"
+
+FrameUniforms::FrameUniforms() : _uniformBuffer(0) {}
+
+void FrameUniforms::init() {
+    // Initialize OpenGL functions.
+    initializeOpenGLFunctions();
+
+    // Allocate the buffer once, it is only overwritten afterwards.
+    glGenBuffers(1, &_uniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, _uniformBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameData), nullptr, GL_DYNAMIC_DRAW);
+
+    // Every program binds its FrameData block to this binding point.
+    glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, _uniformBuffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glCheckError();
+}
+
+void FrameUniforms::update(const FrameData& frameData) {
+    glBindBuffer(GL_UNIFORM_BUFFER, _uniformBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameData), &frameData);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void FrameUniforms::destroy() {
+    glDeleteBuffers(1, &_uniformBuffer);
+    _uniformBuffer = 0;
+}
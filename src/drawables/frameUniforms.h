@@ -0,0 +1,57 @@
+#ifndef FRAME_UNIFORMS_H
+#define FRAME_UNIFORMS_H
+
+#include <QOpenGLFunctions_4_1_Core>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "glm/ext/vector_float3.hpp"
+#include "glm/ext/vector_int2.hpp"
+
+/**
+ * @brief The per-frame data shared by all programs, laid out according to std140.
+ *
+ * NOTE: this must be the same as the FrameData block in src/shaders/frameData.glsl.
+ */
+struct FrameData {
+    glm::mat4 projectionMatrix; /**< Transformation into NDC */
+    glm::mat4 viewMatrix;       /**< Transformation into view space */
+    glm::vec3 moonDirection;    /**< Direction to the moon */
+    float elapsedTime;          /**< Time driving the animation of the sky and the waves */
+    glm::ivec2 lightTileAmount; /**< The amount of tiles of the LightGrid in x and y direction */
+    int lightTileSize;          /**< Width and height of a tile of the LightGrid in pixels */
+    int padding;                /**< Pads the block to a multiple of 16 bytes */
+};
+
+static_assert(sizeof(FrameData) == 2 * 64 + 16 + 16, "FrameData must match std140");
+
+/**
+ * @brief Uniform buffer holding the FrameData, updated once per frame and bound to every program.
+ */
+class FrameUniforms : protected QOpenGLFunctions_4_1_Core {
+   public:
+    static constexpr GLuint bindingPoint = 0;             /**< The binding point of the FrameData block */
+    static constexpr const char* blockName = "FrameData"; /**< The name of the block in the shaders */
+
+    FrameUniforms();
+
+    /**
+     * @brief Creates the uniform buffer and binds it to the binding point, requires a current OpenGL context.
+     */
+    void init();
+
+    /**
+     * @brief Uploads the data of the current frame.
+     * @param frameData - the data of the current frame.
+     */
+    void update(const FrameData& frameData);
+
+    /**
+     * @brief Deletes the uniform buffer.
+     */
+    void destroy();
+
+   private:
+    GLuint _uniformBuffer; /**< Handle of the uniform buffer */
+};
+
+#endif  // FRAME_UNIFORMS_H
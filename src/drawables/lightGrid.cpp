@@ -0,0 +1,145 @@
+#include "src/drawables/lightGrid.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "src/utils/utils.h"
+
+LightGrid::LightGrid() : _lightBuffer{0, 0}, _tileBuffer{0, 0}, _indexBuffer{0, 0}, _tileAmount(0, 0) {}
+
+void LightGrid::init() {
+    // Initialize OpenGL functions.
+    initializeOpenGLFunctions();
+
+    _lightBuffer = createTextureBuffer(GL_RGBA32F);
+    _tileBuffer = createTextureBuffer(GL_RG32UI);
+    _indexBuffer = createTextureBuffer(GL_R32UI);
+    glCheckError();
+}
+
+LightGrid::TextureBuffer LightGrid::createTextureBuffer(GLenum format) {
+    TextureBuffer textureBuffer;
+    glGenBuffers(1, &textureBuffer.buffer);
+    upload(textureBuffer, 0, nullptr);
+
+    // The texture reads the buffer, it stays valid when the storage of the buffer is replaced.
+    glGenTextures(1, &textureBuffer.texture);
+    glBindTexture(GL_TEXTURE_BUFFER, textureBuffer.texture);
+    glTexBuffer(GL_TEXTURE_BUFFER, format, textureBuffer.buffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+    return textureBuffer;
+}
+
+void LightGrid::upload(const TextureBuffer& textureBuffer, GLsizeiptr size, const void* data) {
+    // Orphan the storage, so the driver does not wait for the previous frame. Never leave a buffer empty.
+    glBindBuffer(GL_TEXTURE_BUFFER, textureBuffer.buffer);
+    glBufferData(GL_TEXTURE_BUFFER, std::max<GLsizeiptr>(size, 16), nullptr, GL_STREAM_DRAW);
+    if (size > 0) {
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, size, data);
+    }
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+bool LightGrid::screenBounds(const glm::vec4& light, const glm::mat4& projectionMatrix, float near, glm::vec4& bounds) {
+    // The camera looks along -z, cut the bounding box of the light at the near plane.
+    float radius = light.w;
+    float nearestZ = std::min(light.z + radius, -near);
+    float farthestZ = light.z - radius;
+    if (farthestZ >= nearestZ) {
+        return false;
+    }
+
+    // The projection of the remaining box is bounded by the projections of its corners.
+    glm::vec2 minimum(FLT_MAX), maximum(-FLT_MAX);
+    for (int corner = 0; corner < 8; corner++) {
+        glm::vec4 position((corner & 1) != 0 ? light.x + radius : light.x - radius,
+                           (corner & 2) != 0 ? light.y + radius : light.y - radius,
+                           (corner & 4) != 0 ? nearestZ : farthestZ, 1.0f);
+        glm::vec4 clipPosition = projectionMatrix * position;
+        glm::vec2 devicePosition(clipPosition.x / clipPosition.w, clipPosition.y / clipPosition.w);
+        minimum = glm::min(minimum, devicePosition);
+        maximum = glm::max(maximum, devicePosition);
+    }
+    bounds = glm::vec4(minimum.x, minimum.y, maximum.x, maximum.y);
+
+    // Lights outside of the viewport are culled.
+    return maximum.x >= -1.0f && minimum.x <= 1.0f && maximum.y >= -1.0f && minimum.y <= 1.0f;
+}
+
+void LightGrid::update(const glm::mat4& projectionMatrix, int width, int height) {
+    _tileAmount = glm::ivec2((width + tileSize - 1) / tileSize, (height + tileSize - 1) / tileSize);
+    const std::size_t tileCount = static_cast<std::size_t>(_tileAmount.x) * _tileAmount.y;
+
+    // Recover the near plane from the perspective projection.
+    const float near = projectionMatrix[3][2] / (projectionMatrix[2][2] - 1.0f);
+
+    // Find the tiles covered by every light and count the lights of every tile.
+    _tileRanges.assign(tileCount * 2, 0);
+    _lightTiles.resize(_lights.size());
+    for (std::size_t i = 0; i < _lights.size(); i++) {
+        glm::vec4 bounds;
+        if (!screenBounds(_lights[i], projectionMatrix, near, bounds)) {
+            // An empty range of tiles.
+            _lightTiles[i] = glm::ivec4(0, 0, -1, -1);
+            continue;
+        }
+
+        // Convert normalized device coordinates to tiles.
+        auto toTile = [](float device, int pixels, int tiles) {
+            int tile = static_cast<int>(std::floor((device * 0.5f + 0.5f) * pixels / tileSize));
+            return std::clamp(tile, 0, tiles - 1);
+        };
+        glm::ivec4& tiles = _lightTiles[i];
+        tiles = glm::ivec4(toTile(bounds.x, width, _tileAmount.x), toTile(bounds.y, height, _tileAmount.y),
+                           toTile(bounds.z, width, _tileAmount.x), toTile(bounds.w, height, _tileAmount.y));
+        for (int y = tiles.y; y <= tiles.w; y++) {
+            for (int x = tiles.x; x <= tiles.z; x++) {
+                _tileRanges[(y * _tileAmount.x + x) * 2 + 1]++;
+            }
+        }
+    }
+
+    // The first index of every tile is the sum of the counts of all previous tiles.
+    GLuint indexAmount = 0;
+    for (std::size_t tile = 0; tile < tileCount; tile++) {
+        _tileRanges[tile * 2] = indexAmount;
+        indexAmount += _tileRanges[tile * 2 + 1];
+        _tileRanges[tile * 2 + 1] = 0;
+    }
+
+    // Fill in the light indices, the counts are rebuilt on the way.
+    _lightIndices.resize(indexAmount);
+    for (std::size_t i = 0; i < _lights.size(); i++) {
+        const glm::ivec4& tiles = _lightTiles[i];
+        for (int y = tiles.y; y <= tiles.w; y++) {
+            for (int x = tiles.x; x <= tiles.z; x++) {
+                GLuint* range = &_tileRanges[(y * _tileAmount.x + x) * 2];
+                _lightIndices[range[0] + range[1]++] = static_cast<GLuint>(i);
+            }
+        }
+    }
+
+    // Upload the grid.
+    upload(_lightBuffer, _lights.size() * sizeof(glm::vec4), _lights.data());
+    upload(_tileBuffer, _tileRanges.size() * sizeof(GLuint), _tileRanges.data());
+    upload(_indexBuffer, _lightIndices.size() * sizeof(GLuint), _lightIndices.data());
+}
+
+void LightGrid::bind() {
+    glActiveTexture(GL_TEXTURE0 + lightTextureUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, _lightBuffer.texture);
+    glActiveTexture(GL_TEXTURE0 + tileTextureUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, _tileBuffer.texture);
+    glActiveTexture(GL_TEXTURE0 + indexTextureUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, _indexBuffer.texture);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+void LightGrid::destroy() {
+    for (TextureBuffer* textureBuffer : {&_lightBuffer, &_tileBuffer, &_indexBuffer}) {
+        glDeleteTextures(1, &textureBuffer->texture);
+        glDeleteBuffers(1, &textureBuffer->buffer);
+        *textureBuffer = {0, 0};
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef LIGHT_GRID_H
+#define LIGHT_GRID_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <cstddef>
+#include <vector>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "glm/ext/vector_float3.hpp"
+#include "glm/ext/vector_float4.hpp"
+#include "glm/ext/vector_int2.hpp"
+#include "glm/ext/vector_int4.hpp"
+
+/**
+ * @brief Bins the point lights into screen tiles, so every fragment only evaluates the lights reaching its tile.
+ *
+ * The lights are binned on the CPU, as OpenGL 4.1 has neither compute shaders nor storage buffers.
+ * The result is uploaded into three texture buffers:
+ * the lights (view space position and radius), the index range of every tile and the light indices of all tiles.
+ */
+class LightGrid : protected QOpenGLFunctions_4_1_Core {
+   public:
+    static constexpr int tileSize = 32;          /**< Width and height of a tile in pixels */
+    static constexpr GLint lightTextureUnit = 1; /**< Texture unit of the lights */
+    static constexpr GLint tileTextureUnit = 2;  /**< Texture unit of the index ranges of the tiles */
+    static constexpr GLint indexTextureUnit = 3; /**< Texture unit of the light indices */
+
+    LightGrid();
+
+    /**
+     * @brief Creates the texture buffers, requires a current OpenGL context.
+     */
+    void init();
+
+    /**
+     * @brief Removes all lights, called once per frame before the lights are added.
+     */
+    void clearLights() { _lights.clear(); }
+
+    /**
+     * @brief Adds a point light.
+     * @param viewPosition - the position of the light in view space.
+     * @param radius - the distance at which the light fades out completely.
+     */
+    void addLight(const glm::vec3& viewPosition, float radius) { _lights.emplace_back(viewPosition, radius); }
+
+    /**
+     * @brief Adds point lights to be written directly by the caller.
+     * @param amount - the amount of lights.
+     * @return the storage of the lights, to be filled with their view space position (xyz) and radius (w).
+     */
+    glm::vec4* addLights(std::size_t amount) {
+        _lights.resize(_lights.size() + amount);
+        return _lights.data() + _lights.size() - amount;
+    }
+
+    /**
+     * @brief Bins the lights into the tiles of the viewport and uploads the result.
+     * @param projectionMatrix - the perspective projection of the frame.
+     * @param width - the width of the viewport in pixels.
+     * @param height - the height of the viewport in pixels.
+     */
+    void update(const glm::mat4& projectionMatrix, int width, int height);
+
+    /**
+     * @brief Binds the texture buffers to their texture units, leaves texture unit 0 active.
+     */
+    void bind();
+
+    /**
+     * @brief Deletes the texture buffers.
+     */
+    void destroy();
+
+    /**
+     * @brief Returns the amount of tiles in x and y direction of the last update.
+     * @return the amount of tiles.
+     */
+    glm::ivec2 tileAmount() const { return _tileAmount; }
+
+   private:
+    /**
+     * @brief A texture buffer, the buffer holds the data and the texture is sampled in the shaders.
+     */
+    struct TextureBuffer {
+        GLuint buffer;  /**< Handle of the buffer */
+        GLuint texture; /**< Handle of the texture reading the buffer */
+    };
+
+    /**
+     * @brief Creates a texture buffer.
+     * @param format - the sized internal format of a texel.
+     * @return the created texture buffer.
+     */
+    TextureBuffer createTextureBuffer(GLenum format);
+
+    /**
+     * @brief Replaces the content of a texture buffer.
+     * @param textureBuffer - the texture buffer.
+     * @param size - the size of the data in bytes.
+     * @param data - the data.
+     */
+    void upload(const TextureBuffer& textureBuffer, GLsizeiptr size, const void* data);
+
+    /**
+     * @brief Computes the screen bounds of a light, conservatively via its bounding box in front of the near plane.
+     * @param light - the view space position and radius of the light.
+     * @param projectionMatrix - the perspective projection of the frame.
+     * @param near - the distance of the near plane.
+     * @param bounds - receives the minimum (xy) and maximum (zw) of the light in normalized device coordinates.
+     * @return false if the light does not reach the viewport.
+     */
+    static bool screenBounds(const glm::vec4& light, const glm::mat4& projectionMatrix, float near, glm::vec4& bounds);
+
+    TextureBuffer _lightBuffer;          /**< The lights, view space position and radius */
+    TextureBuffer _tileBuffer;           /**< The first index and the amount of indices of every tile */
+    TextureBuffer _indexBuffer;          /**< The light indices of all tiles */
+    glm::ivec2 _tileAmount;              /**< The amount of tiles in x and y direction */
+    std::vector<glm::vec4> _lights;      /**< The lights of this frame */
+    std::vector<glm::ivec4> _lightTiles; /**< The covered tiles of every light, empty if it is not visible */
+    std::vector<GLuint> _tileRanges;     /**< The first index and the amount of indices of every tile */
+    std::vector<GLuint> _lightIndices;   /**< The light indices of all tiles, ordered by tile */
+};
+
+#endif  // LIGHT_GRID_H
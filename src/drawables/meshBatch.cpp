@@ -0,0 +1,83 @@
+#include "src/drawables/meshBatch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "src/utils/utils.h"
+
+MeshBatch::MeshBatch(std::string meshPath, std::size_t instanceCapacity)
+    : FloppyMesh(std::move(meshPath), 1.0f, 0.0f), _instanceBuffer(0), _instanceBufferSize(0) {
+    _instanceMatrices.reserve(instanceCapacity);
+}
+
+MeshBatch::~MeshBatch() = default;
+
+void MeshBatch::init() {
+    // Initialize OpenGL funtions, replacing glewInit().
+    initializeOpenGLFunctions();
+
+    // Load the shared program, the model view matrix is an instance attribute.
+    loadProgram("src/shaders/cookTorranceInstanced.vs.glsl", "src/shaders/cookTorrance.fs.glsl");
+    loadMaterialUniforms();
+
+    // Retrieve the shared geometry and materials.
+    loadMesh();
+    if (_mesh == nullptr) {
+        return;
+    }
+
+    // Read the vertices and indices of the cached mesh through an own vertex array object holding the instance buffer.
+    // A matrix attribute occupies one location per column, each column advances once per instance.
+    _vertexArrayObject = createSharedVertexArray(_mesh->vertexBuffer, _mesh->indexBuffer);
+    glGenBuffers(1, &_instanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    _instanceBufferSize = _instanceMatrices.capacity() * sizeof(glm::mat4);
+    glBufferData(GL_ARRAY_BUFFER, _instanceBufferSize, nullptr, GL_STREAM_DRAW);
+    for (GLuint column = 0; column < 4; column++) {
+        GLuint location = 3 + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                              reinterpret_cast<void*>(static_cast<uintptr_t>(column * sizeof(glm::vec4))));
+        glVertexAttribDivisor(location, 1);
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glCheckError();
+}
+
+void MeshBatch::draw() {
+    if (_program == 0 || _mesh == nullptr) {
+        qDebug() << "Program or mesh not initialized.";
+        return;
+    }
+    if (_instanceMatrices.empty()) {
+        return;
+    }
+
+    // Upload the instances of this frame, the buffer only grows if they do not fit anymore.
+    // Orphaning the buffer keeps the driver from waiting for the previous frame still reading it.
+    GLsizeiptr size = _instanceMatrices.size() * sizeof(glm::mat4);
+    _instanceBufferSize = std::max(_instanceBufferSize, size);
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER, _instanceBufferSize, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, _instanceMatrices.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Load program.
+    glUseProgram(_program);
+
+    // Bind vertex array object.
+    glBindVertexArray(_vertexArrayObject);
+    glCheckError();
+
+    // Draw all instances with one draw call per part.
+    drawParts(static_cast<GLsizei>(_instanceMatrices.size()));
+}
+
+void MeshBatch::destroy() {
+    glDeleteVertexArrays(1, &_vertexArrayObject);
+    glDeleteBuffers(1, &_instanceBuffer);
+    _vertexArrayObject = 0;
+    _instanceBuffer = 0;
+}
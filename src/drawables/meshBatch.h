@@ -0,0 +1,70 @@
+#ifndef MESH_BATCH_H
+#define MESH_BATCH_H
+
+#include <string>
+#include <vector>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "src/drawables/floppyMesh.h"
+
+/**
+ * @brief Draws every instance of a mesh with one instanced draw call per part of the mesh.
+ *
+ * The instances are collected during the update, every instance only contributes its model view matrix.
+ * The batch reads the buffers of the cached mesh through its own vertex array object, which adds the instance
+ * attributes, so the vertex array object of the cached mesh stays free of them.
+ */
+class MeshBatch : public FloppyMesh {
+   public:
+    /**
+     * @brief Creates an empty batch.
+     * @param meshPath - the path of the mesh drawn by the batch.
+     * @param instanceCapacity - the amount of instances to preallocate, the batch grows if more are added.
+     */
+    explicit MeshBatch(std::string meshPath, std::size_t instanceCapacity = 0);
+
+    ~MeshBatch() override;
+
+    /**
+     * @brief initialize the batch, loads the mesh and creates the instance buffer.
+     */
+    void init() override;
+
+    /**
+     * @brief draw all instances added since the last call of clearInstances().
+     */
+    void draw() override;
+
+    /**
+     * @brief Deletes the vertex array object and the instance buffer of the batch.
+     */
+    void destroy();
+
+    /**
+     * @brief Removes all instances, called once before the drawables are updated.
+     */
+    void clearInstances() { _instanceMatrices.clear(); }
+
+    /**
+     * @brief Adds an instance to draw.
+     * @param modelViewMatrix - the model view matrix of the instance.
+     */
+    void addInstance(const glm::mat4& modelViewMatrix) { _instanceMatrices.push_back(modelViewMatrix); }
+
+    /**
+     * @brief Adds instances to be written directly by the caller.
+     * @param amount - the amount of instances.
+     * @return the storage of the model view matrices of the instances.
+     */
+    glm::mat4* addInstances(std::size_t amount) {
+        _instanceMatrices.resize(_instanceMatrices.size() + amount);
+        return _instanceMatrices.data() + _instanceMatrices.size() - amount;
+    }
+
+   protected:
+    GLuint _instanceBuffer;                   /**< Buffer holding the model view matrices of the instances */
+    GLsizeiptr _instanceBufferSize;           /**< The allocated size of the instance buffer in bytes */
+    std::vector<glm::mat4> _instanceMatrices; /**< The model view matrices of the instances of this frame */
+};
+
+#endif  // MESH_BATCH_H
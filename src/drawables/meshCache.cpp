@@ -0,0 +1,26 @@
+#include "src/drawables/meshCache.h"
+
+#include <QOpenGLContext>
+#include <QOpenGLVersionFunctionsFactory>
+
+std::unordered_map<std::string, std::shared_ptr<Mesh>> MeshCache::_meshes;
+
+std::shared_ptr<Mesh> MeshCache::find(const std::string& meshPath) {
+    auto iterator = _meshes.find(meshPath);
+    return iterator != _meshes.end() ? iterator->second : nullptr;
+}
+
+void MeshCache::insert(const std::string& meshPath, const std::shared_ptr<Mesh>& mesh) { _meshes[meshPath] = mesh; }
+
+void MeshCache::clear() {
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    if (gl != nullptr) {
+        for (auto& [meshPath, mesh] : _meshes) {
+            gl->glDeleteVertexArrays(1, &mesh->vertexArrayObject);
+            gl->glDeleteBuffers(1, &mesh->vertexBuffer);
+            gl->glDeleteBuffers(1, &mesh->indexBuffer);
+        }
+    }
+    _meshes.clear();
+}
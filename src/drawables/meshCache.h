@@ -0,0 +1,69 @@
+#ifndef MESH_CACHE_H
+#define MESH_CACHE_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "glm/ext/vector_float3.hpp"
+#include "src/drawables/textureCache.h"
+
+/**
+ * @brief The range and material of a single part of a mesh.
+ */
+struct MeshPart {
+    GLint baseVertex;                 /**< The first vertex of the part inside the vertex buffers */
+    GLuint indexOffset;               /**< The offset of the first index of the part inside the index buffer in bytes */
+    GLuint indexAmount;               /**< The amount of indices used to draw the part */
+    GLenum indexType;                 /**< The type of the indices, either 16- or 32-bit */
+    std::shared_ptr<Texture> texture; /**< The albedo texture, shared with all parts using the same image */
+    float shininess;                  /**< The shininess of the part. */
+    float transparency;               /**< The transparency/dissolve/alpha of the part. */
+    glm::vec3 emissiveColour;         /**< The colour of the emission of the part. */
+};
+
+/**
+ * @brief The GPU geometry of a mesh, shared by all meshes loading the same file.
+ */
+struct Mesh {
+    GLuint vertexArrayObject;    /**< The vertex array object containing the vertices of all parts */
+    GLuint vertexBuffer;         /**< The interleaved vertices of all parts, shared with other vertex array objects */
+    GLuint indexBuffer;          /**< The indices of all parts, shared with other vertex array objects */
+    std::vector<MeshPart> parts; /**< The parts of the mesh */
+};
+
+/**
+ * @brief Process-wide cache of meshes, keyed by the path of the mesh.
+ *
+ * Meshes loading the same file share the parsed geometry and the vertex array object, so every file is parsed and
+ * uploaded only once. The textures of the parts are shared through the TextureCache.
+ */
+class MeshCache {
+   public:
+    /**
+     * @brief Looks up a cached mesh.
+     * @param meshPath - the path of the mesh.
+     * @return the cached mesh or nullptr if it was not loaded yet.
+     */
+    static std::shared_ptr<Mesh> find(const std::string& meshPath);
+
+    /**
+     * @brief Stores a loaded mesh in the cache.
+     * @param meshPath - the path of the mesh.
+     * @param mesh - the loaded mesh.
+     */
+    static void insert(const std::string& meshPath, const std::shared_ptr<Mesh>& mesh);
+
+    /**
+     * @brief Deletes the vertex array objects and buffers of all cached meshes and releases their textures,
+     * requires a current OpenGL context.
+     */
+    static void clear();
+
+   private:
+    static std::unordered_map<std::string, std::shared_ptr<Mesh>> _meshes; /**< The cached meshes */
+};
+
+#endif  // MESH_CACHE_H
@@ -0,0 +1,142 @@
+#include "src/drawables/obstacles/obstacleRenderer.h"
+
+#include <cmath>
+#include <vector>
+
+#include "glm/common.hpp"
+#include "glm/ext/matrix_transform.hpp"
+#include "glm/gtc/type_ptr.hpp"
+#include "src/config/config.h"
+#include "src/utils/utils.h"
+
+namespace {
+/**
+ * @brief Composes the local transformation of a mesh, a rotation around the y-axis, a uniform scale and a translation.
+ * @param x - the x-coordinate of the mesh.
+ * @param y - the y-coordinate of the mesh.
+ * @param scale - the uniform scale of the mesh.
+ * @param rotation - the rotation around the y-axis in degrees.
+ * @return the transformation, equal to translate(x, y, 0) * scale(scale) * rotate(rotation, y-axis).
+ */
+glm::mat4 meshTransformation(float x, float y, float scale, float rotation) {
+    const float cosine = scale * std::cos(glm::radians(rotation));
+    const float sine = scale * std::sin(glm::radians(rotation));
+    glm::mat4 transformation(1.0f);
+    transformation[0] = glm::vec4(cosine, 0.0f, -sine, 0.0f);
+    transformation[1] = glm::vec4(0.0f, scale, 0.0f, 0.0f);
+    transformation[2] = glm::vec4(sine, 0.0f, cosine, 0.0f);
+    transformation[3] = glm::vec4(x, y, 0.0f, 1.0f);
+    return transformation;
+}
+}  // namespace
+
+ObstacleRenderer::ObstacleRenderer(const ObstacleCourse& course)
+    : Drawable(),
+      _course(course),
+      _signBatch(std::make_shared<MeshBatch>("res/Sign.obj", Config::obstacleAmount)),
+      _lampBatch(std::make_shared<MeshBatch>("res/Lamp.obj", Config::obstacleAmount)),
+      _interpolation(0.0f),
+      _hitboxColour(0.1f, 0.7f, 0.3f) {}
+
+ObstacleRenderer::~ObstacleRenderer() = default;
+
+void ObstacleRenderer::init() {
+    // Initialize OpenGL functions.
+    Drawable::init();
+
+    // Every asset is loaded once, by its batch.
+    _signBatch->init();
+    _lampBatch->init();
+
+    // Load the shared hitbox program and look up its uniforms once.
+    loadProgram("src/shaders/hitbox.vs.glsl", "src/shaders/hitbox.fs.glsl");
+    _uniforms.modelViewMatrix = uniformLocation("modelview_matrix");
+    _uniforms.hitboxColour = uniformLocation("hitboxColour");
+
+    // Fill the vertices of the hitbox quad, only the positions are used.
+    std::vector<Vertex> vertices = {
+        Vertex(glm::vec3(-1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(-1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(-1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, -1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+        Vertex(glm::vec3(1, 1, 0), glm::vec3(0.0f), glm::vec2(0.0f)),
+    };
+
+    // Set up a vertex array object for the geometry.
+    _vertexArrayObject = createVertexArray(vertices);
+    glCheckError();
+}
+
+void ObstacleRenderer::update(float interpolation, glm::mat4 modelViewMatrix) {
+    _interpolation = interpolation;
+    _modelViewMatrix = modelViewMatrix;
+
+    // Write the sign and the lamp of every obstacle straight into the batches, the offsets center the meshes inside
+    // the hitboxes of the parts.
+    const std::size_t amount = _course.size();
+    _signBatch->clearInstances();
+    _lampBatch->clearInstances();
+    glm::mat4* signs = _signBatch->addInstances(amount);
+    glm::mat4* lamps = _lampBatch->addInstances(amount);
+    for (std::size_t i = 0; i < amount; i++) {
+        const ObstacleState obstacle = _course[i];
+        const float x = glm::mix(obstacle.previousX, obstacle.x, interpolation);
+        signs[i] = modelViewMatrix * meshTransformation(x, obstacle.upperY() - obstacle.upperHeight, signScale,
+                                                        obstacle.upperRotation);
+        lamps[i] = modelViewMatrix * meshTransformation(x, obstacle.lowerY() + obstacle.lowerHeight, lampScale,
+                                                        obstacle.lowerRotation);
+    }
+}
+
+void ObstacleRenderer::draw() {
+    _signBatch->draw();
+    _lampBatch->draw();
+}
+
+void ObstacleRenderer::drawHitboxes() {
+    // Only draw the hitbox quads if the debug-flag is enabled.
+    if (!Config::showHitbox) {
+        return;
+    }
+    if (_program == 0) {
+        qDebug() << "Program not initialized.";
+        return;
+    }
+
+    // Load program and bind vertex array object.
+    glUseProgram(_program);
+    glBindVertexArray(_vertexArrayObject);
+    glUniform3fv(_uniforms.hitboxColour, 1, glm::value_ptr(_hitboxColour));
+    glCheckError();
+
+    // Draw both parts of every obstacle.
+    for (std::size_t i = 0; i < _course.size(); i++) {
+        const ObstacleState obstacle = _course[i];
+        const float x = glm::mix(obstacle.previousX, obstacle.x, _interpolation);
+        const glm::mat4 obstacleMatrix = translate(_modelViewMatrix, glm::vec3(x, 0.0f, 0.0f));
+        drawHitbox(obstacleMatrix, obstacle.upperY(), obstacle.upperHeight);
+        drawHitbox(obstacleMatrix, obstacle.lowerY(), obstacle.lowerHeight);
+    }
+
+    // Unbind vertex array object.
+    glBindVertexArray(0);
+    glCheckError();
+}
+
+void ObstacleRenderer::destroy() {
+    _signBatch->destroy();
+    _lampBatch->destroy();
+    glDeleteVertexArrays(1, &_vertexArrayObject);
+    _vertexArrayObject = 0;
+}
+
+void ObstacleRenderer::drawHitbox(const glm::mat4& obstacleMatrix, float y, float height) {
+    // Move the quad to the part and scale it to the hitbox.
+    const glm::mat4 hitboxMatrix = scale(translate(obstacleMatrix, glm::vec3(0.0f, y, 0.0f)),
+                                         glm::vec3(Config::obstacleWidth, height, Config::obstacleDepth));
+    glUniformMatrix4fv(_uniforms.modelViewMatrix, 1, GL_FALSE, glm::value_ptr(hitboxMatrix));
+
+    // Call draw.
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 6);
+}
@@ -0,0 +1,79 @@
+#ifndef OBSTACLE_RENDERER_H
+#define OBSTACLE_RENDERER_H
+
+#include <cstddef>
+#include <memory>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "glm/ext/vector_float3.hpp"
+#include "src/core/obstacleCourse.h"
+#include "src/drawables/drawable.h"
+#include "src/drawables/meshBatch.h"
+
+/**
+ * @brief Draws all obstacles of the course straight from its arrays.
+ *
+ * There is no drawable per obstacle: the update runs once over the course and writes the model view matrices of
+ * the signs and the lamps into their batches, which draw them with one instanced draw call per part of the mesh.
+ * The hitboxes are drawn from the same arrays.
+ */
+class ObstacleRenderer : public Drawable {
+   public:
+    static constexpr float signScale = 2.0f; /**< Scale of the sign mesh on the upper parts */
+    static constexpr float lampScale = 1.0f; /**< Scale of the lamp mesh on the lower parts */
+
+    /**
+     * @param course The simulated obstacles, only read for rendering.
+     */
+    explicit ObstacleRenderer(const ObstacleCourse& course);
+    ~ObstacleRenderer() override;
+
+    /**
+     * @brief Initialize the batches and the hitbox quad.
+     */
+    void init() override;
+
+    /**
+     * @brief Writes the meshes of all obstacles into the batches, placed between the last two steps.
+     * @param interpolation The progress from the previous to the current simulation step in [0, 1]
+     * @param modelViewMatrix The view matrix of the scene.
+     */
+    void update(float interpolation, glm::mat4 modelViewMatrix) override;
+
+    /**
+     * @brief Draw the meshes of all obstacles.
+     */
+    void draw() override;
+
+    /**
+     * @brief Draw the hitboxes of all obstacles if Config::showHitbox is set.
+     */
+    void drawHitboxes();
+
+    /**
+     * @brief Deletes the buffers of the batches and the hitbox quad.
+     */
+    void destroy();
+
+   private:
+    /**
+     * @brief Draws the hitbox quad of a part, expects the program and vertex array object to be bound.
+     * @param obstacleMatrix The model view matrix of the obstacle.
+     * @param y The y-coordinate of the center of the part.
+     * @param height The half height of the part.
+     */
+    void drawHitbox(const glm::mat4& obstacleMatrix, float y, float height);
+
+    const ObstacleCourse& _course;         /**< The simulated obstacles. */
+    std::shared_ptr<MeshBatch> _signBatch; /**< Batch drawing the signs of all upper parts. */
+    std::shared_ptr<MeshBatch> _lampBatch; /**< Batch drawing the lamps of all lower parts. */
+    float _interpolation;                  /**< The progress between the last two steps of the last update. */
+    glm::vec3 _hitboxColour;               /**< Colour of the hitboxes. */
+    /** @brief Locations of the uniforms of the hitbox program, looked up once in init(). */
+    struct {
+        GLint modelViewMatrix; /**< Location of the model view matrix. */
+        GLint hitboxColour;    /**< Location of the hitbox colour. */
+    } _uniforms;
+};
+
+#endif  // OBSTACLE_RENDERER_H
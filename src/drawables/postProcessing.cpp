@@ -15,64 +15,20 @@ void PostProcessingQuad::init() {
     // Initialize OpenGL functions.
     Drawable::init();
 
-    // Create a program for this class.
-    _program = glCreateProgram();
-
-    // Compile shader.
-    GLuint vs = Drawable::compileShader(GL_VERTEX_SHADER, "src/shaders/postProcessing.vs.glsl");
-    GLuint fs = Drawable::compileShader(GL_FRAGMENT_SHADER, "src/shaders/postProcessing.fs.glsl");
-
-    // Attach shader to the program.
-    glAttachShader(_program, vs);
-    glAttachShader(_program, fs);
-
-    // Link program.
-    _program = Drawable::linkProgram(_program);
-
-    // Fill position buffer with data.
-    std::vector positions = {
-        glm::vec3(-1, -1, 1.0),
-        glm::vec3(1, -1, 1.0),
-        glm::vec3(1, 1, 1.0),
-        glm::vec3(-1, 1, 1.0),
+    // Load the shared program and look up its uniforms once.
+    loadProgram("src/shaders/postProcessing.vs.glsl", "src/shaders/postProcessing.fs.glsl");
+    _uniforms.gamma = uniformLocation("gamma");
+
+    // Fill the vertices of the screen filling quad, the normals are unused.
+    std::vector<Vertex> vertices = {
+        Vertex(glm::vec3(-1, -1, 1.0), glm::vec3(0.0f), glm::vec2(0, 0)),
+        Vertex(glm::vec3(1, -1, 1.0), glm::vec3(0.0f), glm::vec2(1, 0)),
+        Vertex(glm::vec3(1, 1, 1.0), glm::vec3(0.0f), glm::vec2(1, 1)),
+        Vertex(glm::vec3(-1, 1, 1.0), glm::vec3(0.0f), glm::vec2(0, 1)),
     };
 
     // Set up a vertex array object for the geometry.
-    if (_vertexArrayObject == 0) {
-        glGenVertexArrays(1, &_vertexArrayObject);
-    }
-    glBindVertexArray(_vertexArrayObject);
-
-    // Fill vertex array object with position data.
-    GLuint position_buffer;
-    glGenBuffers(1, &position_buffer);
-    glBindBuffer(GL_ARRAY_BUFFER, position_buffer);
-    glBufferData(GL_ARRAY_BUFFER, positions.size() * 3 * sizeof(float), positions.data(), GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(0);
-
-    // Fill the texture coordinates buffer with data.
-    std::vector<glm::vec2> texcoords = {
-        glm::vec2(0, 0),
-        glm::vec2(1, 0),
-        glm::vec2(1, 1),
-        glm::vec2(0, 1),
-    };
-
-    GLuint texture_coordinate_buffer;
-    glGenBuffers(1, &texture_coordinate_buffer);
-    glBindBuffer(GL_ARRAY_BUFFER, texture_coordinate_buffer);
-    // Size of two, due to coordinates s and t.
-    glBufferData(GL_ARRAY_BUFFER, texcoords.size() * 2 * sizeof(float), texcoords.data(), GL_STATIC_DRAW);
-    // Use index '2', and size of two again.
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(2);
-
-    // Unbind vertex array object.
-    glBindVertexArray(0);
-    // Delete buffers (the data is stored in the vertex array object).
-    glDeleteBuffers(1, &position_buffer);
-    glDeleteBuffers(1, &texture_coordinate_buffer);
+    _vertexArrayObject = createVertexArray(vertices);
 
     // Check for errors.
     glCheckError();
@@ -85,9 +41,9 @@ void PostProcessingQuad::bind() {
     glBindFramebuffer(GL_FRAMEBUFFER, _frameBufferObject);
 }
 
-void PostProcessingQuad::unbind() {
+void PostProcessingQuad::unbind(GLuint targetFramebuffer) {
     // Unbind framebuffer.
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, targetFramebuffer);
 }
 
 void PostProcessingQuad::destroy() { glDeleteFramebuffers(1, &_frameBufferObject); }
@@ -145,10 +101,10 @@ void PostProcessingQuad::draw() {
 
     // Parameters.
     // uniform gamma from Config.
-    glUniform1f(glGetUniformLocation(_program, "gamma"), Config::gamma);
+    glUniform1f(_uniforms.gamma, Config::gamma);
 
     // Call draw.
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 6);
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 
     // Un-bind vertex array object.
     glBindVertexArray(0);
@@ -10,7 +10,7 @@ class PostProcessingQuad : public Drawable {
     /**
      * @brief draw the PostProcessingQuad.
      */
-    void draw();
+    void draw() override;
 
     /**
      * @brief initialize the PostProcessingQuad.
@@ -24,8 +24,9 @@ class PostProcessingQuad : public Drawable {
 
     /**
      * @brief unbind the framebuffer.
+     * @param targetFramebuffer the framebuffer to bind instead, the default framebuffer if omitted.
      */
-    void unbind();
+    void unbind(GLuint targetFramebuffer = 0);
 
     /**
      * @brief Delete the framebuffer.
@@ -41,6 +42,10 @@ class PostProcessingQuad : public Drawable {
     GLuint _textureColourBuffer; /**< Texture handle (memory location of texture). */
     GLuint _depthStencilBuffer;  /**< Texture handle for depth and stencil (memory location of texture). */
     GLuint _frameBufferObject;   /**< Frame buffer handle (memory location of framebuffer). */
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint gamma; /**< Location of the gamma correction value. */
+    } _uniforms;
 };
 
 #endif  // PostProcessingQuad_H
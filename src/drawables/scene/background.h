@@ -16,20 +16,25 @@ class Background : public Drawable {
 
     /**
      * Update the background.
-     * @param elapsedTimeMs - elapsed time since the last update in ms.
+     * @param interpolation - progress from the previous to the current simulation step in [0, 1].
      * @param modelViewMatrix - transformation into view coordinates.
      */
-    void update(float elapsedTimeMs, glm::mat4 modelViewMatrix) override;
+    void update(float interpolation, glm::mat4 modelViewMatrix) override;
 
     /**
      * Draw the background.
-     * @param projectionMatrix - transformation into NDC.
      */
-    void draw(glm::mat4 projectionMatrix);
+    void draw() override;
 
    protected:
-    std::string _texturePath;    /**< path of the texture */
-    unsigned int _textureHandle; /**< handle of the texture */
+    std::string _texturePath;          /**< path of the texture */
+    std::shared_ptr<Texture> _texture; /**< the texture */
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint modelViewMatrix;   /**< Location of the model view matrix. */
+        GLint backgroundTexture; /**< Location of the background texture unit. */
+        GLint animationLooper;   /**< Location of the animation looper. */
+    } _uniforms;
 };
 
 #endif  // BACKGROUND_H
@@ -5,24 +5,37 @@
 
 class Ocean : public Drawable {
    public:
+    static constexpr int minRaymarchSteps = 16;      /**< Steps of raymarching at the lowest quality */
+    static constexpr int maxRaymarchSteps = 64;      /**< Steps of raymarching at the highest quality */
+    static constexpr int minRaymarchIterations = 4;  /**< Wave octaves of raymarching at the lowest quality */
+    static constexpr int maxRaymarchIterations = 12; /**< Wave octaves of raymarching at the highest quality */
+    static constexpr int minNormalIterations = 8;    /**< Wave octaves of the normals at the lowest quality */
+    static constexpr int maxNormalIterations = 36;   /**< Wave octaves of the normals at the highest quality */
+
     Ocean();
 
     /**
      * @brief draw the ocean.
      */
-    void draw(glm::mat4 projectionMatrix);
+    void draw() override;
 
     /**
      * @brief initialize the ocean.
      */
     void init() override;
 
+    /**
+     * @brief simulate Advances the time and the sky rotation by one simulation step.
+     * @param stepMs The length of the simulation step in ms
+     */
+    void simulate(float stepMs) override;
+
     /**
      * @brief update Updates the object's position, rotation etc.
-     * @param elapsedTimeMs The elapsed time since the last update in ms
+     * @param interpolation The progress from the previous to the current simulation step in [0, 1]
      * @param modelViewMatrix the mode view matrix of the parent object
      */
-    void update(float elapsedTimeMs, glm::mat4 modelViewMatrix) override;
+    void update(float interpolation, glm::mat4 modelViewMatrix) override;
 
     /**
      * @brief Returns the direction of the moon.
@@ -30,15 +43,41 @@ class Ocean : public Drawable {
      */
     glm::vec3 getMoonDirection() const { return _moonDirection; }
 
+    /**
+     * @brief Returns the time driving the animation of the sky and the waves.
+     * @return The elapsed time of the ocean, interpolated for the rendered frame.
+     */
+    float getElapsedTime() const { return _renderedTime; }
+
+    /**
+     * @brief Sets the quality of the water, the steps and octaves scale between their minimum and maximum.
+     * The octaves additionally fall off with the distance in the shader.
+     * @param quality The quality level in [0, 1]
+     */
+    void setQuality(float quality);
+
    protected:
-    GLuint _verticeAmount;          /**< The amount of vertices used to draw the triangle */
-    GLuint _textureHandle;          /**< Texture handle (memory location of texture). */
-    float _elapsedTime;             /**< Elapsed time in ms since last update */
-    float _subsequentRotation;      /**< The subsequent rotation around the Y-axis applied to the mesh. */
-    float _subsequentRotationSpeed; /**< The subsequent rotation speed around the Y-axis applied to the mesh. */
-    glm::mat4 _skyRotationMatrix;   /**< Rotation matrix of the skybox. */
-    glm::mat4 _modelViewMatrix;     /**< The model view matrix to get the object into model view space */
-    glm::vec3 _moonDirection;       /**< Direction of the moon (vector) */
+    GLuint _verticeAmount;             /**< The amount of vertices used to draw the triangle */
+    std::shared_ptr<Texture> _texture; /**< The cube map of the sky. */
+    float _elapsedTime;                /**< Time of the current simulation step */
+    float _previousElapsedTime;        /**< Time of the previous simulation step */
+    float _renderedTime;               /**< Time interpolated for the rendered frame */
+    float _subsequentRotation;         /**< The subsequent rotation around the Y-axis applied to the mesh. */
+    float _previousRotation;           /**< The subsequent rotation of the previous simulation step. */
+    float _subsequentRotationSpeed;    /**< The subsequent rotation speed around the Y-axis applied to the mesh. */
+    glm::mat4 _skyRotationMatrix;      /**< Rotation matrix of the skybox. */
+    glm::mat4 _modelViewMatrix;        /**< The model view matrix to get the object into model view space */
+    glm::vec3 _moonDirection;          /**< Direction of the moon (vector) */
+    GLint _raymarchSteps;              /**< Maximum steps of raymarching */
+    GLint _raymarchIterations;         /**< Wave octaves of raymarching */
+    GLint _normalIterations;           /**< Wave octaves of the normals */
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint skyRotationMatrix;  /**< Location of the sky rotation matrix. */
+        GLint raymarchSteps;      /**< Location of the maximum steps of raymarching. */
+        GLint raymarchIterations; /**< Location of the wave octaves of raymarching. */
+        GLint normalIterations;   /**< Location of the wave octaves of the normals. */
+    } _uniforms;
     /**
      * @brief loadTexture loads the textures for the ocean
      */
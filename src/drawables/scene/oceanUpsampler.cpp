@@ -0,0 +1,109 @@
+#include "src/drawables/scene/oceanUpsampler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/utils/utils.h"
+
+OceanUpsampler::OceanUpsampler()
+    : Drawable(),
+      _textureColourBuffer(0),
+      _frameBufferObject(0),
+      _width(0),
+      _height(0),
+      _reducedWidth(0),
+      _reducedHeight(0),
+      _divisor(1) {}
+
+void OceanUpsampler::init() {
+    // Initialize OpenGL functions.
+    Drawable::init();
+
+    // The quad is the one of the post processing, only the fragment shader differs.
+    loadProgram("src/shaders/postProcessing.vs.glsl", "src/shaders/oceanUpsample.fs.glsl");
+    _uniforms.viewportSize = uniformLocation("viewport_size");
+
+    // Fill the vertices of the screen filling quad at the far plane, the normals are unused.
+    std::vector<Vertex> vertices = {
+        Vertex(glm::vec3(-1, -1, 1.0), glm::vec3(0.0f), glm::vec2(0, 0)),
+        Vertex(glm::vec3(1, -1, 1.0), glm::vec3(0.0f), glm::vec2(1, 0)),
+        Vertex(glm::vec3(1, 1, 1.0), glm::vec3(0.0f), glm::vec2(1, 1)),
+        Vertex(glm::vec3(-1, 1, 1.0), glm::vec3(0.0f), glm::vec2(0, 1)),
+    };
+    _vertexArrayObject = createVertexArray(vertices);
+
+    // The framebuffer only holds colour, the ocean is drawn without depth.
+    glGenFramebuffers(1, &_frameBufferObject);
+    glCheckError();
+}
+
+void OceanUpsampler::resize(int width, int height, unsigned int divisor) {
+    _width = width;
+    _height = height;
+    _divisor = std::max(divisor, 1u);
+
+    // Round up, so the texels cover the whole viewport.
+    const int reduction = static_cast<int>(_divisor);
+    _reducedWidth = std::max((width + reduction - 1) / reduction, 1);
+    _reducedHeight = std::max((height + reduction - 1) / reduction, 1);
+
+    glDeleteTextures(1, &_textureColourBuffer);
+    _textureColourBuffer = 0;
+    if (_divisor == 1) {
+        return;
+    }
+
+    // The shader fetches single texels, it does the filtering itself.
+    glGenTextures(1, &_textureColourBuffer);
+    glBindTexture(GL_TEXTURE_2D, _textureColourBuffer);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, _reducedWidth, _reducedHeight, 0, GL_RGB, GL_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _frameBufferObject);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _textureColourBuffer, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glCheckError();
+}
+
+void OceanUpsampler::bind() {
+    glBindFramebuffer(GL_FRAMEBUFFER, _frameBufferObject);
+    glViewport(0, 0, _reducedWidth, _reducedHeight);
+}
+
+void OceanUpsampler::draw() {
+    if (_program == 0 || _textureColourBuffer == 0) {
+        qDebug() << "Program or framebuffer not initialized.";
+        return;
+    }
+
+    // Load program.
+    glUseProgram(_program);
+
+    // Bind vertex array object and the ocean at the reduced resolution.
+    glBindVertexArray(_vertexArrayObject);
+    glBindTexture(GL_TEXTURE_2D, _textureColourBuffer);
+
+    // The pixels are mapped to the texels through the size of the full resolution viewport.
+    glUniform2f(_uniforms.viewportSize, static_cast<float>(_width), static_cast<float>(_height));
+
+    // Call draw.
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+
+    // Un-bind vertex array object and texture.
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Check for errors.
+    glCheckError();
+}
+
+void OceanUpsampler::destroy() {
+    glDeleteTextures(1, &_textureColourBuffer);
+    glDeleteFramebuffers(1, &_frameBufferObject);
+    _textureColourBuffer = 0;
+    _frameBufferObject = 0;
+}
@@ -0,0 +1,66 @@
+#ifndef OCEAN_UPSAMPLER_H
+#define OCEAN_UPSAMPLER_H
+
+#include "src/drawables/drawable.h"
+
+/**
+ * @brief Renders the ocean at a reduced resolution and upsamples it into the framebuffer of the scene.
+ *
+ * The ocean drawn between bind() and draw() lands in a colour texture of a fraction of the viewport. The upsampling
+ * is bilateral: the four texels around a pixel are weighted bilinearly and by how closely their distance to the water
+ * matches the one of the pixel, so the horizon stays sharp while the low-frequency waves are interpolated. The ocean
+ * writes no depth, the distance is computed from the camera in the shader instead.
+ */
+class OceanUpsampler : public Drawable {
+   public:
+    OceanUpsampler();
+
+    /**
+     * @brief Loads the program, creates the screen filling quad and the framebuffer.
+     */
+    void init() override;
+
+    /**
+     * @brief Recreates the colour texture for a new viewport, none is needed at full resolution.
+     * @param width - the width of the full resolution viewport.
+     * @param height - the height of the full resolution viewport.
+     * @param divisor - the ocean is rendered at 1/divisor of the width and height, 1 disables the upsampling.
+     */
+    void resize(int width, int height, unsigned int divisor);
+
+    /**
+     * @brief Binds the framebuffer and sets the viewport of the reduced resolution.
+     */
+    void bind();
+
+    /**
+     * @brief Draws the upsampled ocean at the far plane of the bound framebuffer, its viewport has to be set before.
+     */
+    void draw() override;
+
+    /**
+     * @brief Deletes the framebuffer and the colour texture.
+     */
+    void destroy();
+
+    /**
+     * @brief Returns the divisor of the resolution of the last resize.
+     * @return the divisor, 1 if the ocean is drawn at full resolution.
+     */
+    unsigned int divisor() const { return _divisor; }
+
+   protected:
+    GLuint _textureColourBuffer; /**< Texture handle of the ocean at the reduced resolution */
+    GLuint _frameBufferObject;   /**< Frame buffer handle */
+    int _width;                  /**< Width of the full resolution viewport */
+    int _height;                 /**< Height of the full resolution viewport */
+    int _reducedWidth;           /**< Width of the reduced resolution */
+    int _reducedHeight;          /**< Height of the reduced resolution */
+    unsigned int _divisor;       /**< The divisor of the resolution */
+    /** @brief Locations of the uniforms of the program, looked up once in init(). */
+    struct {
+        GLint viewportSize; /**< Location of the size of the full resolution viewport. */
+    } _uniforms;
+};
+
+#endif  // OCEAN_UPSAMPLER_H
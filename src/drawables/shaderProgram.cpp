@@ -0,0 +1,16 @@
+#include "src/drawables/shaderProgram.h"
+
+#include <QDebug>
+#include <utility>
+
+ShaderProgram::ShaderProgram(GLuint handle, std::string name, std::unordered_map<std::string, GLint> uniformLocations)
+    : _handle(handle), _name(std::move(name)), _uniformLocations(std::move(uniformLocations)) {}
+
+GLint ShaderProgram::uniformLocation(const std::string& name) const {
+    auto iterator = _uniformLocations.find(name);
+    if (iterator == _uniformLocations.end()) {
+        qDebug() << "Uniform" << name << "does not exist or is unused in program" << _name;
+        return -1;
+    }
+    return iterator->second;
+}
@@ -0,0 +1,43 @@
+#ifndef SHADER_PROGRAM_H
+#define SHADER_PROGRAM_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief A linked shader program together with the locations of its active uniforms.
+ *
+ * The locations are resolved once at link time, drawables look them up once after loading the program
+ * and keep them instead of calling glGetUniformLocation every frame. The handle is owned by the ShaderProgramCache.
+ */
+class ShaderProgram {
+   public:
+    /**
+     * @brief Wraps a linked program.
+     * @param handle - the handle of the linked program, 0 if linking failed.
+     * @param name - the name of the program used in warnings.
+     * @param uniformLocations - the locations of all active uniforms, arrays without their "[0]" suffix.
+     */
+    ShaderProgram(GLuint handle, std::string name, std::unordered_map<std::string, GLint> uniformLocations);
+
+    /**
+     * @brief Returns the handle of the program.
+     * @return the handle of the program, 0 if linking failed.
+     */
+    GLuint handle() const { return _handle; }
+
+    /**
+     * @brief Returns the location of a uniform and warns if the program has no active uniform with that name.
+     * @param name - the name of the uniform.
+     * @return the location of the uniform or -1, which OpenGL silently ignores.
+     */
+    GLint uniformLocation(const std::string& name) const;
+
+   private:
+    GLuint _handle;                                           /**< The handle of the linked program. */
+    std::string _name;                                        /**< The name of the program used in warnings. */
+    std::unordered_map<std::string, GLint> _uniformLocations; /**< The locations of all active uniforms. */
+};
+
+#endif  // SHADER_PROGRAM_H
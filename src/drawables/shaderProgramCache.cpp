@@ -0,0 +1,26 @@
+#include "src/drawables/shaderProgramCache.h"
+
+#include <QOpenGLContext>
+#include <QOpenGLVersionFunctionsFactory>
+
+std::unordered_map<std::string, std::shared_ptr<ShaderProgram>> ShaderProgramCache::_programs;
+
+std::shared_ptr<ShaderProgram> ShaderProgramCache::find(const std::string& name) {
+    auto iterator = _programs.find(name);
+    return iterator != _programs.end() ? iterator->second : nullptr;
+}
+
+void ShaderProgramCache::insert(const std::string& name, const std::shared_ptr<ShaderProgram>& program) {
+    _programs[name] = program;
+}
+
+void ShaderProgramCache::clear() {
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    if (gl != nullptr) {
+        for (auto& [name, program] : _programs) {
+            gl->glDeleteProgram(program->handle());
+        }
+    }
+    _programs.clear();
+}
@@ -0,0 +1,41 @@
+#ifndef SHADER_PROGRAM_CACHE_H
+#define SHADER_PROGRAM_CACHE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "src/drawables/shaderProgram.h"
+
+/**
+ * @brief Process-wide cache of linked programs, keyed by the paths of their shaders.
+ *
+ * Drawables using the same shaders share one program, so every pair of shaders is compiled and linked only once.
+ * The cache owns the handles of the programs, they are deleted by clear().
+ */
+class ShaderProgramCache {
+   public:
+    /**
+     * @brief Looks up a cached program.
+     * @param name - the paths of the vertex and fragment shader, joined by " + ".
+     * @return the cached program or nullptr if it was not linked yet.
+     */
+    static std::shared_ptr<ShaderProgram> find(const std::string& name);
+
+    /**
+     * @brief Stores a linked program in the cache, which takes over its handle.
+     * @param name - the paths of the vertex and fragment shader, joined by " + ".
+     * @param program - the linked program.
+     */
+    static void insert(const std::string& name, const std::shared_ptr<ShaderProgram>& program);
+
+    /**
+     * @brief Deletes all cached programs, requires a current OpenGL context.
+     */
+    static void clear();
+
+   private:
+    static std::unordered_map<std::string, std::shared_ptr<ShaderProgram>> _programs; /**< The cached programs */
+};
+
+#endif  // SHADER_PROGRAM_CACHE_H
@@ -0,0 +1,114 @@
+#include "src/drawables/textureCache.h"
+
+#include <QDebug>
+#include <QOpenGLContext>
+#include <QOpenGLVersionFunctionsFactory>
+
+#include "src/drawables/textureLoader.h"
+
+std::map<std::pair<std::string, GLenum>, std::weak_ptr<Texture>> TextureCache::_textures;
+
+std::shared_ptr<Texture> TextureCache::load(const std::vector<std::string>& paths, GLenum target,
+                                            GLenum internalFormat) {
+    std::string name;
+    for (const std::string& path : paths) {
+        name += (name.empty() ? "" : ";") + path;
+    }
+
+    // Share the texture as long as someone holds it.
+    std::weak_ptr<Texture>& entry = _textures[{name, internalFormat}];
+    if (std::shared_ptr<Texture> texture = entry.lock()) {
+        return texture;
+    }
+
+    std::shared_ptr<Texture> texture(new Texture{0, target, internalFormat, name}, release);
+    TextureLoader::load(texture, paths);
+    entry = texture;
+    return texture;
+}
+
+void TextureCache::report() {
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    std::size_t totalMemory = 0;
+    for (auto& [key, entry] : _textures) {
+        std::shared_ptr<Texture> texture = entry.lock();
+        if (texture == nullptr || texture->handle == 0) {
+            continue;
+        }
+        // The local reference is not a user.
+        const std::size_t size = memory(gl, *texture);
+        qDebug() << "Texture" << texture->name.c_str() << "has" << texture.use_count() - 1 << "users and"
+                 << size / 1024 << "KiB.";
+        totalMemory += size;
+    }
+    qDebug() << "Textures use" << totalMemory / 1024 << "KiB in total.";
+}
+
+void TextureCache::clear() {
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    if (gl != nullptr) {
+        for (auto& [key, entry] : _textures) {
+            if (std::shared_ptr<Texture> texture = entry.lock()) {
+                gl->glDeleteTextures(1, &texture->handle);
+                texture->handle = 0;
+            }
+        }
+    }
+    _textures.clear();
+}
+
+std::size_t TextureCache::memory(QOpenGLFunctions_4_1_Core* gl, const Texture& texture) {
+    std::size_t size = 0;
+    gl->glBindTexture(texture.target, texture.handle);
+    const GLenum faceAmount = texture.target == GL_TEXTURE_CUBE_MAP ? 6 : 1;
+    for (GLenum face = 0; face < faceAmount; face++) {
+        const GLenum image = texture.target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face
+                                                                   : texture.target;
+        // Walk the mip chain until the first missing level.
+        for (GLint level = 0;; level++) {
+            GLint width = 0, height = 0, compressed = GL_FALSE;
+            gl->glGetTexLevelParameteriv(image, level, GL_TEXTURE_WIDTH, &width);
+            gl->glGetTexLevelParameteriv(image, level, GL_TEXTURE_HEIGHT, &height);
+            if (width == 0 || height == 0) {
+                break;
+            }
+            gl->glGetTexLevelParameteriv(image, level, GL_TEXTURE_COMPRESSED, &compressed);
+            if (compressed == GL_TRUE) {
+                GLint compressedSize = 0;
+                gl->glGetTexLevelParameteriv(image, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &compressedSize);
+                size += static_cast<std::size_t>(compressedSize);
+                continue;
+            }
+
+            // Uncompressed levels take the bits of their channels, padding by the driver is not visible.
+            GLint bits = 0;
+            for (GLenum channel : {GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE,
+                                   GL_TEXTURE_ALPHA_SIZE}) {
+                GLint channelBits = 0;
+                gl->glGetTexLevelParameteriv(image, level, channel, &channelBits);
+                bits += channelBits;
+            }
+            size += static_cast<std::size_t>(width) * height * bits / 8;
+        }
+    }
+    gl->glBindTexture(texture.target, 0);
+    return size;
+}
+
+void TextureCache::release(Texture* texture) {
+    // A texture deleted by clear() or without a context left is only forgotten.
+    QOpenGLContext* context = QOpenGLContext::currentContext();
+    if (texture->handle != 0 && context != nullptr) {
+        QOpenGLFunctions_4_1_Core* gl = QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(context);
+        gl->glDeleteTextures(1, &texture->handle);
+    }
+
+    // Forget the entry, unless clear() already did.
+    auto entry = _textures.find({texture->name, texture->internalFormat});
+    if (entry != _textures.end() && entry->second.expired()) {
+        _textures.erase(entry);
+    }
+    delete texture;
+}
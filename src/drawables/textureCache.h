@@ -0,0 +1,69 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A texture shared by all its users, deleted when the last user releases it.
+ */
+struct Texture {
+    GLuint handle;         /**< Handle of the texture, 0 once it was deleted */
+    GLenum target;         /**< GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP */
+    GLenum internalFormat; /**< The requested internal format of the texture */
+    std::string name;      /**< The paths of the images, separated by ';' for cube maps */
+};
+
+/**
+ * @brief Process-wide registry of textures, keyed by the paths of the images and the internal format.
+ *
+ * The internal format follows from the Drawable::TextureType, so an image loaded as two types yields two textures.
+ * The registry only holds weak references, every user holds a shared one. A texture is thus loaded once however many
+ * meshes and parts use it, and deleted as soon as its last user goes away.
+ */
+class TextureCache {
+   public:
+    /**
+     * @brief Returns the texture of the images, loading it through the TextureLoader if no one holds it yet.
+     * @param paths - the paths of the images, one for a 2D texture, six for a cube map.
+     * @param target - GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP.
+     * @param internalFormat - the internal format of the texture.
+     * @return the shared texture, its parameters can be set before the images arrive.
+     */
+    static std::shared_ptr<Texture> load(const std::vector<std::string>& paths, GLenum target, GLenum internalFormat);
+
+    /**
+     * @brief Logs the users and the video memory of every texture, requires the textures to be complete.
+     */
+    static void report();
+
+    /**
+     * @brief Deletes all textures still in use, requires a current OpenGL context.
+     * The users keep their references, which are released without touching OpenGL afterwards.
+     */
+    static void clear();
+
+   private:
+    /**
+     * @brief Computes the video memory of all levels and faces of a texture.
+     * @param gl - the OpenGL functions of the current context.
+     * @param texture - the texture.
+     * @return the size of the texture in bytes, as requested from the driver.
+     */
+    static std::size_t memory(QOpenGLFunctions_4_1_Core* gl, const Texture& texture);
+
+    /**
+     * @brief Deletes a texture and removes it from the registry, called when its last user released it.
+     * @param texture - the texture.
+     */
+    static void release(Texture* texture);
+
+    static std::map<std::pair<std::string, GLenum>, std::weak_ptr<Texture>> _textures; /**< The textures in use */
+};
+
+#endif  // TEXTURE_CACHE_H
@@ -0,0 +1,271 @@
+#include "src/drawables/textureLoader.h"
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QOpenGLContext>
+#include <QOpenGLVersionFunctionsFactory>
+#include <QThreadPool>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "src/utils/bakedTexture.h"
+
+std::atomic<TextureLoader::DecodedImage*> TextureLoader::_decoded{nullptr};
+std::atomic<unsigned int> TextureLoader::_decodedAmount{0};
+std::vector<TextureLoader::PendingTexture> TextureLoader::_pending;
+std::size_t TextureLoader::_requestedImages = 0;
+std::size_t TextureLoader::_uploadedImages = 0;
+std::size_t TextureLoader::_uploadedBytes = 0;
+GLuint TextureLoader::_pixelBuffer = 0;
+
+void TextureLoader::load(const std::shared_ptr<Texture>& owner, const std::vector<std::string>& paths) {
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+
+    gl->glGenTextures(1, &owner->handle);
+    const GLenum target = owner->target;
+    const GLenum internalFormat = owner->internalFormat;
+    const std::size_t texture = _pending.size();
+    _pending.push_back({owner, static_cast<unsigned int>(paths.size()), false, false});
+
+    // The sRGB variants of S3TC come with the sRGB extension, RGTC is core since OpenGL 3.0.
+    const QOpenGLContext* context = QOpenGLContext::currentContext();
+    const bool s3tc = context->hasExtension("GL_EXT_texture_compression_s3tc");
+    const bool srgbS3tc = s3tc && context->hasExtension("GL_EXT_texture_sRGB");
+
+    // Decode every image on its own worker, the faces of a cube map are decoded in parallel as well.
+    for (std::size_t i = 0; i < paths.size(); i++) {
+        const GLenum face = target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + static_cast<GLenum>(i)
+                                                          : target;
+        const std::string path = paths[i];
+        QThreadPool::globalInstance()->start([texture, face, path, internalFormat, s3tc, srgbS3tc]() {
+            DecodedImage* image = new DecodedImage{nullptr, texture, face, path, 0, {}, {}, std::nullopt};
+            decode(*image, internalFormat, s3tc, srgbS3tc);
+            push(image);
+        });
+        _requestedImages++;
+    }
+}
+
+std::size_t TextureLoader::poll() {
+    // Take the whole queue at once, the workers keep pushing onto an empty queue meanwhile.
+    DecodedImage* newest = _decoded.exchange(nullptr, std::memory_order_acquire);
+    if (newest == nullptr) {
+        return 0;
+    }
+
+    // The queue links from the newest to the oldest image, reverse it to upload in order of completion.
+    DecodedImage* oldest = nullptr;
+    while (newest != nullptr) {
+        DecodedImage* next = newest->next;
+        newest->next = oldest;
+        oldest = newest;
+        newest = next;
+    }
+
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    std::size_t uploaded = 0;
+    while (oldest != nullptr) {
+        DecodedImage* next = oldest->next;
+        upload(gl, *oldest);
+        delete oldest;
+        oldest = next;
+        uploaded++;
+    }
+    _uploadedImages += uploaded;
+    return uploaded;
+}
+
+void TextureLoader::finish() {
+    if (_uploadedImages == _requestedImages) {
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+    const std::size_t images = _requestedImages - _uploadedImages;
+    while (_uploadedImages < _requestedImages) {
+        // Read the counter before taking the queue, an image pushed afterwards changes it and ends the wait.
+        const unsigned int decodedAmount = _decodedAmount.load(std::memory_order_acquire);
+        if (poll() == 0) {
+            _decodedAmount.wait(decodedAmount, std::memory_order_acquire);
+        }
+    }
+    qDebug() << "Decoded and uploaded" << images << "images," << _uploadedBytes / 1024 << "KiB in" << timer.elapsed()
+             << "ms.";
+    _uploadedBytes = 0;
+
+    // Every texture is complete, no image refers to the pending textures anymore.
+    _pending.clear();
+}
+
+void TextureLoader::clear() {
+    finish();
+    QOpenGLFunctions_4_1_Core* gl =
+        QOpenGLVersionFunctionsFactory::get<QOpenGLFunctions_4_1_Core>(QOpenGLContext::currentContext());
+    if (gl != nullptr) {
+        gl->glDeleteBuffers(1, &_pixelBuffer);
+    }
+    _pixelBuffer = 0;
+}
+
+void TextureLoader::decode(DecodedImage& image, GLenum internalFormat, bool s3tc, bool srgbS3tc) {
+    if (readBaked(image, internalFormat, s3tc, srgbS3tc)) {
+        return;
+    }
+
+    // Decode the image, the mip chain is generated once the texture is complete.
+    image.image.emplace(image.path);
+    const GLsizei width = static_cast<GLsizei>(image.image->getWidth());
+    const GLsizei height = static_cast<GLsizei>(image.image->getHeight());
+    if (width > 0 && height > 0) {
+        image.levels.push_back({0, static_cast<std::size_t>(width) * height * 4, width, height});
+    }
+}
+
+bool TextureLoader::readBaked(DecodedImage& image, GLenum internalFormat, bool s3tc, bool srgbS3tc) {
+    std::ifstream file(BakedTexture::pathFor(image.path), std::ios::binary | std::ios::ate);
+    if (!file) {
+        return false;
+    }
+    image.data.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(image.data.data()), static_cast<std::streamsize>(image.data.size()));
+    BakedTexture::View view;
+    if (!file || !BakedTexture::read(image.data.data(), image.data.size(), view)) {
+        qDebug() << "Ignoring the outdated baked texture of" << image.path.c_str();
+        image.data.clear();
+        return false;
+    }
+
+    // The blocks have to decode to what the internal format of the texture expects, otherwise the image is used.
+    GLenum compressedFormat = 0;
+    bool supported = s3tc;
+    switch (view.format) {
+        case BlockCompression::Bc1:
+            if (internalFormat == GL_SRGB_ALPHA && view.srgb) {
+                compressedFormat = GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+                supported = srgbS3tc;
+            } else if ((internalFormat == GL_RGBA || internalFormat == GL_RGB) && !view.srgb) {
+                compressedFormat = GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+            }
+            break;
+        case BlockCompression::Bc3:
+            if (internalFormat == GL_SRGB_ALPHA && view.srgb) {
+                compressedFormat = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+                supported = srgbS3tc;
+            } else if (internalFormat == GL_RGBA && !view.srgb) {
+                compressedFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            }
+            break;
+        case BlockCompression::Bc4:
+            if (internalFormat == GL_RED && !view.srgb) {
+                compressedFormat = GL_COMPRESSED_RED_RGTC1;
+                supported = true;
+            }
+            break;
+    }
+    if (compressedFormat == 0) {
+        qDebug() << "Ignoring the baked texture of" << image.path.c_str() << "with a mismatching format.";
+        image.data.clear();
+        return false;
+    }
+
+    if (supported) {
+        // Upload the blocks straight from the blob.
+        image.compressedFormat = compressedFormat;
+        for (const BakedTexture::LevelView& level : view.levels) {
+            image.levels.push_back({static_cast<std::size_t>(level.data - image.data.data()), level.size,
+                                    static_cast<GLsizei>(level.width), static_cast<GLsizei>(level.height)});
+        }
+        return true;
+    }
+
+    // Without driver support the blocks are decompressed, which still skips decoding and generating the mipmaps.
+    std::vector<unsigned char> pixels;
+    for (const BakedTexture::LevelView& level : view.levels) {
+        const std::size_t size = static_cast<std::size_t>(level.width) * level.height * 4;
+        image.levels.push_back({pixels.size(), size, static_cast<GLsizei>(level.width),
+                                static_cast<GLsizei>(level.height)});
+        pixels.resize(pixels.size() + size);
+        BlockCompression::decompress(view.format, level.data, level.width, level.height,
+                                     pixels.data() + image.levels.back().offset);
+    }
+    image.data.swap(pixels);
+    return true;
+}
+
+void TextureLoader::push(DecodedImage* image) {
+    // Lock-free push, any amount of workers push concurrently. The consumer only ever takes the whole queue, so an
+    // image can not be removed and reinserted between the load and the exchange of the head.
+    DecodedImage* head = _decoded.load(std::memory_order_relaxed);
+    do {
+        image->next = head;
+    } while (!_decoded.compare_exchange_weak(head, image, std::memory_order_release, std::memory_order_relaxed));
+
+    // Wake up finish() if it waits for this image.
+    _decodedAmount.fetch_add(1, std::memory_order_release);
+    _decodedAmount.notify_one();
+}
+
+void TextureLoader::upload(QOpenGLFunctions_4_1_Core* gl, DecodedImage& image) {
+    if (image.levels.empty()) {
+        qDebug() << "Could not decode" << image.path.c_str();
+    }
+
+    // The handle of a texture released while its images were decoded is deleted, or reused by a newer texture.
+    PendingTexture& texture = _pending[image.texture];
+    const std::shared_ptr<Texture> owner = texture.owner.lock();
+    if (owner == nullptr || owner->handle == 0) {
+        texture.missingImages--;
+        return;
+    }
+    const unsigned char* data = image.image ? image.image->getData() : image.data.data();
+    GLsizeiptr size = 0;
+    for (const ImageLevel& level : image.levels) {
+        size = std::max(size, static_cast<GLsizeiptr>(level.offset + level.size));
+    }
+
+    // Copy the image into the pixel buffer object, orphaning its previous storage so the driver does not wait for
+    // the previous upload. The texture reads from the buffer, which allows the driver to transfer it asynchronously.
+    if (_pixelBuffer == 0) {
+        gl->glGenBuffers(1, &_pixelBuffer);
+    }
+    gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _pixelBuffer);
+    if (size > 0) {
+        gl->glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        void* pixels =
+            gl->glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        std::memcpy(pixels, data, size);
+        gl->glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    // The data pointers are offsets into the bound pixel buffer object.
+    gl->glBindTexture(owner->target, owner->handle);
+    for (std::size_t i = 0; i < image.levels.size(); i++) {
+        const ImageLevel& level = image.levels[i];
+        const void* offset = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(level.offset));
+        if (image.compressedFormat != 0) {
+            gl->glCompressedTexImage2D(image.face, static_cast<GLint>(i), image.compressedFormat, level.width,
+                                       level.height, 0, static_cast<GLsizei>(level.size), offset);
+        } else {
+            gl->glTexImage2D(image.face, static_cast<GLint>(i), owner->internalFormat, level.width, level.height, 0,
+                             GL_RGBA, GL_UNSIGNED_BYTE, offset);
+        }
+        _uploadedBytes += level.size;
+    }
+    gl->glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    // The mipmaps are generated once the last image of the texture arrived, unless every image brought its own. A
+    // cube map missing a face is incomplete and glGenerateMipmap would fail on it.
+    texture.generateMipmap = texture.generateMipmap || (image.image.has_value() && !image.levels.empty());
+    texture.incomplete = texture.incomplete || image.levels.empty();
+    texture.missingImages--;
+    if (texture.missingImages == 0 && texture.generateMipmap && !texture.incomplete) {
+        gl->glGenerateMipmap(owner->target);
+    }
+    gl->glBindTexture(owner->target, 0);
+}
@@ -0,0 +1,135 @@
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "src/drawables/textureCache.h"
+#include "src/utils/imageTexture.h"
+
+/**
+ * @brief Process-wide loader decoding the images of textures in parallel, off the OpenGL thread.
+ *
+ * A texture is created right away, while its images are decoded by the global thread pool. Finished images are
+ * handed back to the OpenGL thread through a lock-free queue and uploaded through a pixel buffer object.
+ * The textures are complete once poll() or finish() uploaded all their images, the mipmaps are generated then.
+ * Loading all textures of a scene thus takes about as long as decoding its largest image.
+ *
+ * If a texture was baked next to an image (see BakedTexture), the blocks and the mip chain of the blob are uploaded
+ * as they are, which skips decoding, generating the mipmaps and most of the upload bandwidth. Drivers without S3TC
+ * get the blocks decompressed by the workers. The faces of a cube map should be baked all together or not at all.
+ *
+ * All functions but the decoding run on the OpenGL thread with a current context.
+ */
+class TextureLoader {
+   public:
+    /**
+     * @brief Creates the handle of a texture and starts decoding its images.
+     *
+     * The loader only holds a weak reference to the texture. The images of a texture released before they arrived
+     * are dropped, as its handle was deleted or may even belong to another texture by then.
+     * @param owner - the texture, its target and internal format are set, its handle is set by the loader. The
+     * images are RGBA8888.
+     * @param paths - the paths of the images, one for a 2D texture, six for a cube map in the order +x, -x, +y, -y,
+     * +z, -z.
+     */
+    static void load(const std::shared_ptr<Texture>& owner, const std::vector<std::string>& paths);
+
+    /**
+     * @brief Uploads the images decoded so far without waiting for the others.
+     * @return the amount of uploaded images.
+     */
+    static std::size_t poll();
+
+    /**
+     * @brief Waits for all requested images and uploads each as soon as it is decoded.
+     */
+    static void finish();
+
+    /**
+     * @brief Waits for all requested images and deletes the pixel buffer object, the textures stay with their owners.
+     */
+    static void clear();
+
+   private:
+    /**
+     * @brief A texture waiting for its images.
+     */
+    struct PendingTexture {
+        std::weak_ptr<Texture> owner; /**< The texture, expired once its last user released it */
+        unsigned int missingImages;   /**< The amount of images not uploaded yet */
+        bool generateMipmap;          /**< Whether an image arrived without its mip chain */
+        bool incomplete;              /**< Whether an image could not be loaded, the mipmaps are not generated then */
+    };
+
+    /**
+     * @brief A mip level of an image, stored in the data of the image.
+     */
+    struct ImageLevel {
+        std::size_t offset; /**< The offset of the level in the data of the image in bytes */
+        std::size_t size;   /**< The size of the level in bytes */
+        GLsizei width;      /**< The width of the level in pixels */
+        GLsizei height;     /**< The height of the level in pixels */
+    };
+
+    /**
+     * @brief An image decoded by a worker, linked into the queue of finished images.
+     */
+    struct DecodedImage {
+        DecodedImage* next;                /**< The image finished before, set by the queue */
+        std::size_t texture;               /**< Index of the texture in the pending textures */
+        GLenum face;                       /**< The target of the image, the face for cube maps */
+        std::string path;                  /**< The path of the image */
+        GLenum compressedFormat;           /**< The compressed format of the levels, 0 if they are RGBA8888 */
+        std::vector<ImageLevel> levels;    /**< The mip levels, empty if the image could not be loaded */
+        std::vector<unsigned char> data;   /**< The baked blob or the decompressed levels, unless decoded */
+        std::optional<ImageTexture> image; /**< The decoded image, if no baked texture could be used */
+    };
+
+    /**
+     * @brief Loads an image, preferring a baked texture compatible with the texture over decoding the image.
+     * @param image - the image to load, its texture, face and path are set.
+     * @param internalFormat - the internal format of the texture.
+     * @param s3tc - whether the driver supports S3TC.
+     * @param srgbS3tc - whether the driver supports S3TC with sRGB.
+     */
+    static void decode(DecodedImage& image, GLenum internalFormat, bool s3tc, bool srgbS3tc);
+
+    /**
+     * @brief Loads the baked texture of an image if it matches the internal format of the texture.
+     * @param image - the image to load.
+     * @param internalFormat - the internal format of the texture.
+     * @param s3tc - whether the driver supports S3TC.
+     * @param srgbS3tc - whether the driver supports S3TC with sRGB.
+     * @return false if there is no compatible baked texture.
+     */
+    static bool readBaked(DecodedImage& image, GLenum internalFormat, bool s3tc, bool srgbS3tc);
+
+    /**
+     * @brief Appends a decoded image to the queue, called by the workers.
+     * @param image - the image, owned by the queue afterwards.
+     */
+    static void push(DecodedImage* image);
+
+    /**
+     * @brief Uploads all levels of an image through the pixel buffer object and completes its texture.
+     * @param gl - the OpenGL functions of the current context.
+     * @param image - the image.
+     */
+    static void upload(QOpenGLFunctions_4_1_Core* gl, DecodedImage& image);
+
+    static std::atomic<DecodedImage*> _decoded;      /**< Head of the queue, the newest finished image */
+    static std::atomic<unsigned int> _decodedAmount; /**< The amount of images pushed, waited on by finish() */
+    static std::vector<PendingTexture> _pending;     /**< The textures waiting for their images */
+    static std::size_t _requestedImages;             /**< The amount of images requested */
+    static std::size_t _uploadedImages;              /**< The amount of images uploaded */
+    static std::size_t _uploadedBytes;               /**< The amount of bytes uploaded since the last finish() */
+    static GLuint _pixelBuffer;                      /**< The pixel buffer object the images are uploaded through */
+};
+
+#endif  // TEXTURE_LOADER_H
@@ -0,0 +1,177 @@
+#include "src/gui/frameBenchmark.h"
+
+#include <QDebug>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLFramebufferObject>
+#include <QOpenGLFunctions>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "src/config/config.h"
+#include "src/core/autopilot.h"
+#include "src/gui/passProfiler.h"
+#include "src/gui/sceneRenderer.h"
+
+namespace FrameBenchmark {
+
+namespace {
+constexpr unsigned int warmUpFrames = 60; /**< Frames to fill caches and compile shaders before measuring */
+constexpr std::uint32_t seed = 1;         /**< The seed of the first game, the following games count upwards */
+constexpr float interpolation = 0.5f;     /**< Places every frame between two steps, so the interpolation runs */
+
+/**
+ * @brief Prints the statistics of a series of times as a row of the result table.
+ * @param name - the name of the row.
+ * @param cpuTimes - the CPU times in ms.
+ * @param gpuTimes - the GPU times in ms.
+ */
+void printRow(const char* name, std::vector<double>& cpuTimes, std::vector<double>& gpuTimes) {
+    const PassProfiler::Percentiles cpu = PassProfiler::percentiles(cpuTimes);
+    const PassProfiler::Percentiles gpu = PassProfiler::percentiles(gpuTimes);
+    printf("%-16s %8.3f %8.3f %8.3f %8.3f %8.3f | %8.3f %8.3f %8.3f %8.3f %8.3f\n", name, cpu.mean, cpu.p50, cpu.p90,
+           cpu.p99, cpu.max, gpu.mean, gpu.p50, gpu.p90, gpu.p99, gpu.max);
+}
+
+/**
+ * @brief Prints the statistics of all passes and of the whole frame.
+ * @param profiler - the profiler holding the timings of the measured frames.
+ */
+void report(const PassProfiler& profiler) {
+    std::vector<double> cpuTimes(profiler.frameAmount());
+    std::vector<double> gpuTimes(profiler.frameAmount());
+    printf("%-16s %8s %8s %8s %8s %8s | %8s %8s %8s %8s %8s\n", "Pass [ms]", "CPU mean", "p50", "p90", "p99", "max",
+           "GPU mean", "p50", "p90", "p99", "max");
+    for (std::size_t pass = 0; pass < PassProfiler::PassAmount; pass++) {
+        for (std::size_t i = 0; i < profiler.frameAmount(); i++) {
+            cpuTimes[i] = profiler.frame(i).cpu[pass].duration();
+            gpuTimes[i] = profiler.frame(i).gpu[pass].duration();
+        }
+        printRow(PassProfiler::passName(static_cast<PassProfiler::Pass>(pass)), cpuTimes, gpuTimes);
+    }
+    for (std::size_t i = 0; i < profiler.frameAmount(); i++) {
+        cpuTimes[i] = profiler.frame(i).cpuFrame().duration();
+        gpuTimes[i] = profiler.frame(i).gpuFrame().duration();
+    }
+    printRow("Frame", cpuTimes, gpuTimes);
+}
+
+/**
+ * @brief The GPU times of the ocean and of the whole frame at one resolution of the ocean.
+ */
+struct OceanResult {
+    unsigned int resolution;         /**< The divisor of the resolution of the ocean */
+    PassProfiler::Percentiles ocean; /**< GPU times of the ocean pass in ms */
+    PassProfiler::Percentiles frame; /**< GPU times of the whole frame in ms */
+};
+
+/**
+ * @brief Summarizes the GPU times of the ocean and of the whole frame.
+ * @param profiler - the profiler holding the timings of the measured frames.
+ * @param resolution - the divisor of the resolution of the ocean.
+ * @return the statistics of the measured frames.
+ */
+OceanResult oceanResult(const PassProfiler& profiler, unsigned int resolution) {
+    std::vector<double> oceanTimes(profiler.frameAmount());
+    std::vector<double> frameTimes(profiler.frameAmount());
+    for (std::size_t i = 0; i < profiler.frameAmount(); i++) {
+        oceanTimes[i] = profiler.frame(i).gpu[PassProfiler::Ocean].duration();
+        frameTimes[i] = profiler.frame(i).gpuFrame().duration();
+    }
+    return {resolution, PassProfiler::percentiles(oceanTimes), PassProfiler::percentiles(frameTimes)};
+}
+}  // namespace
+
+int run(unsigned int frames, int width, int height, const std::string& tracePath,
+        const std::vector<unsigned int>& oceanResolutions) {
+    // Render without a window, the surface is only needed to make the context current.
+    QOffscreenSurface surface;
+    surface.setFormat(QSurfaceFormat::defaultFormat());
+    surface.create();
+    QOpenGLContext context;
+    context.setFormat(QSurfaceFormat::defaultFormat());
+    if (!context.create() || !context.makeCurrent(&surface) || context.format().majorVersion() != 4) {
+        qDebug() << "Cannot get a valid OpenGL context.";
+        return 1;
+    }
+    QOpenGLFunctions* functions = context.functions();
+    printf("Rendering %u frames at %dx%d on %s.\n", frames, width, height,
+           reinterpret_cast<const char*>(functions->glGetString(GL_RENDERER)));
+
+    {
+        SceneRenderer scene;
+        PassProfiler profiler(frames);
+        GameState& game = scene.game();
+
+        // The post processing draws into an offscreen framebuffer instead of a window.
+        QOpenGLFramebufferObject target(width, height);
+        scene.init();
+        profiler.init();
+
+        std::vector<OceanResult> results;
+        for (unsigned int resolution : oceanResolutions) {
+            // Every resolution plays the same games.
+            Config::oceanResolution = resolution;
+            scene.resize(width, height);
+            std::uint32_t gameSeed = seed;
+            game.reset(gameSeed);
+            printf("Ocean at 1/%u of the resolution.\n", resolution);
+
+            std::chrono::steady_clock::time_point start;
+            for (unsigned int frame = 0; frame < warmUpFrames + frames; frame++) {
+                // Drop the warm-up frames and start measuring.
+                if (frame == warmUpFrames) {
+                    profiler.finish();
+                    profiler.clear();
+                    start = std::chrono::steady_clock::now();
+                }
+
+                // Advance by one step per frame and restart with the next seed if the autopilot failed.
+                if (Autopilot::shouldFlop(game)) {
+                    game.flop();
+                }
+                scene.simulate();
+                if (game.isOver()) {
+                    game.reset(++gameSeed);
+                }
+                scene.update(interpolation);
+                scene.render(target.handle(), &profiler);
+            }
+            profiler.finish();
+            functions->glFinish();
+            std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+            printf("Rendered %u frames in %.3f s: %.1f frames/s, %u games, %zu frames measured.\n", frames,
+                   seconds.count(), frames / seconds.count(), gameSeed - seed + 1, profiler.frameAmount());
+            report(profiler);
+            printf("Ocean quality %.0f%% with a GPU budget of %.1f ms.\n", scene.oceanQuality() * 100.0f,
+                   Config::gpuBudget);
+            results.push_back(oceanResult(profiler, resolution));
+        }
+
+        // Compare the resolutions of the ocean side by side.
+        if (results.size() > 1) {
+            printf("%-16s %8s %8s %8s | %8s %8s %8s\n", "Ocean res. [ms]", "Ocean", "p50", "p90", "Frame", "p50",
+                   "p90");
+            for (const OceanResult& result : results) {
+                const std::string name = "1/" + std::to_string(result.resolution);
+                printf("%-16s %8.3f %8.3f %8.3f | %8.3f %8.3f %8.3f\n", name.c_str(), result.ocean.mean,
+                       result.ocean.p50, result.ocean.p90, result.frame.mean, result.frame.p50, result.frame.p90);
+            }
+        }
+        if (!tracePath.empty() && profiler.writeChromeTrace(tracePath)) {
+            printf("Saved the trace of the measured frames to %s.\n", tracePath.c_str());
+        }
+
+        profiler.destroy();
+        scene.destroy();
+    }
+    context.doneCurrent();
+    return 0;
+}
+
+}  // namespace FrameBenchmark
@@ -0,0 +1,29 @@
+#ifndef FRAME_BENCHMARK_H
+#define FRAME_BENCHMARK_H
+
+#include <string>
+#include <vector>
+
+namespace FrameBenchmark {
+
+/**
+ * @brief Renders frames of the full scene without a window and prints the CPU and GPU time of every pass.
+ *
+ * The scene is rendered through an offscreen surface into an offscreen framebuffer, so no display server and no
+ * vsync are involved, e.g. with Mesa llvmpipe on a CI machine. The game is played by the autopilot from a fixed seed
+ * with one simulation step per frame, which makes the rendered frames the same on every run.
+ * The frames are measured once per resolution of the ocean, every run starts from the same seed. With more than one
+ * resolution, the GPU times of the ocean and of the whole frame are compared at the end.
+ * @param frames - the amount of measured frames, preceded by warm-up frames that are not measured.
+ * @param width - the width of the frames.
+ * @param height - the height of the frames.
+ * @param tracePath - the path of a Chrome trace of the frames measured last, none is written if empty.
+ * @param oceanResolutions - the divisors of the resolution of the ocean to measure.
+ * @return the exit code, 0 if it was successful.
+ */
+int run(unsigned int frames, int width, int height, const std::string& tracePath,
+        const std::vector<unsigned int>& oceanResolutions);
+
+}  // namespace FrameBenchmark
+
+#endif  // FRAME_BENCHMARK_H
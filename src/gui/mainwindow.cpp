@@ -8,23 +8,20 @@
 #include <QMessageBox>
 #include <QMouseEvent>
 #include <QOpenGLFunctions>
-#include <cstddef>
+#include <QPainter>
+#include <cmath>
 #include <glm/glm.hpp>
-#include <iostream>
 #include <memory>
 #include <random>
-#include <vector>
 
-#include "glm/ext/matrix_clip_space.hpp"
-#include "glm/ext/matrix_float4x4.hpp"
-#include "glm/ext/matrix_transform.hpp"
-#include "glm/ext/vector_float3.hpp"
 #include "src/config/config.h"
-#include "src/drawables/fishController.h"
-#include "src/drawables/obstacles/obstacle.h"
-#include "src/drawables/scene/ocean.h"
+#include "src/gui/profilerOverlay.h"
 
-GLMainWindow::GLMainWindow() : _updateTimer(this) {
+GLMainWindow::GLMainWindow()
+    : _profiler(600),
+      _accumulatedTimeMs(0.0f),
+      _paintAllocations("paintGL"),
+      _animateAllocations("animateGL") {
     // Set to the preconfigured size.
     setWidth(Config::windowWidth);
     setHeight(Config::windowHeight);
@@ -34,40 +31,10 @@ GLMainWindow::GLMainWindow() : _updateTimer(this) {
 
     setSurfaceType(OpenGLSurface);
 
-    // Update the scene periodically.
-    connect(&_updateTimer, SIGNAL(timeout()), this, SLOT(animateGL()));
-    _updateTimer.start(18);
+    // Update the scene after every frame, the frame rate follows the swap interval of the display.
+    connect(this, SIGNAL(frameSwapped()), this, SLOT(animateGL()));
     _stopWatch.start();
 
-    // Create all the drawables.
-    _billMesh = std::make_shared<FloppyMesh>("res/BillDerLachs.obj", 2.0f, 90.0f),
-
-    _drawables = {
-        // The ocean background.
-        _oceanAndSky = std::make_shared<Ocean>(),
-        // Bill the Salmon.
-        _billTheSalmon = std::make_shared<FishController>(_billMesh),
-        _postProcessing = std::make_shared<PostProcessingQuad>(),
-    };
-
-    // Create the in the Config specified amount of obstacles and add it to the drawables.
-    std::random_device rd;
-    std::mt19937 mt(rd());
-    std::uniform_real_distribution<float> dist(-45.0f, 45.0f);
-    for (std::size_t i = 0; i < Config::obstacleAmount; i++) {
-        auto upperMesh = std::make_shared<FloppyMesh>("res/Sign.obj", 2.0f, dist(mt));
-        auto lowerMesh = std::make_shared<FloppyMesh>("res/Lamp.obj", 1.0f, dist(mt));
-        // Create the obstacle itself.
-        float initialOffset = Config::obstacleInitialOffset + (i * Config::obstacleDistance);
-        auto obstacle = std::make_shared<Obstacle>(initialOffset, upperMesh, lowerMesh);
-
-        // Push this into _drawables to init, update, draw.
-        _drawables.push_back(obstacle);
-
-        // Push this into _obstacles to process lighting and collision.
-        _obstacles.push_back(obstacle);
-    }
-
     // TODO: Initialize the media player.
     _mediaPlayer = std::make_shared<QSoundEffect>();
     _mediaPlayer->setVolume(0.2f);
@@ -95,124 +62,61 @@ void GLMainWindow::show() {
 }
 
 void GLMainWindow::initializeGL() {
-    // Initialize OpenGL functions, replacing glewInit().
-    initializeOpenGLFunctions();
-
     // Make sure the context is current.
     makeCurrent();
 
-    // Enable depth test.
-    glEnable(GL_DEPTH_TEST);
-    glDepthFunc(GL_LESS);
-
-    // Enable multisampling for AA;
-    glEnable(GL_MULTISAMPLE);
-
-    // Enable SRGB framebuffer.
-    glEnable(GL_FRAMEBUFFER_SRGB);
-
-    // Enable alpha blending and selecting blend function.
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
-
-    // Initialize all drawables.
-    for (auto drawable : _drawables) {
-        drawable->init();
-    }
+    // Set up the OpenGL state and initialize all drawables.
+    _scene.init();
+    _profiler.init();
 }
 
-void GLMainWindow::resizeGL(int width, int height) {
-    // Update the viewport.
-    glViewport(0, 0, width, height);
-
-    // Store the resolution in the config.
-    Config::windowWidth = width;
-    Config::windowHeight = height;
-
-    // Calculate projection matrix from current resolution, this allows for resizing the window without distortion.
-    const float aspect = float(Config::windowWidth) / float(Config::windowHeight);
-    _projectionMatrix = glm::perspective(glm::radians(Config::fieldOfVision), aspect, 0.1f, 100.0f);
-
-    _postProcessing->resetBufferTextures(width * Config::resolutionScale, height * Config::resolutionScale);
-}
+void GLMainWindow::resizeGL(int width, int height) { _scene.resize(width, height); }
 
 void GLMainWindow::paintGL() {
-    // Draw filled polygons.
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-
-    // Bind framebuffer.
-    _postProcessing->bind();
-    glEnable(GL_DEPTH_TEST);
-    // Set up view.
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    // Set a background colour.
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    // The frame only uses storage owned by the window and the drawables, no heap allocations are expected.
+    _paintAllocations.begin();
 
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
-        std::cout << "Framebuffer is incomplete: " << std::to_string(glCheckFramebufferStatus(GL_FRAMEBUFFER))
-                  << std::endl;
-    }
-
-    // Disable culling and set a less strict depth function.
-    glDisable(GL_CULL_FACE);
-    glDepthFunc(GL_LEQUAL);
-    // _skybox->draw(_projectionMatrix);
-    _oceanAndSky->draw(_projectionMatrix);
-
-    // Get the current light positions from the obstacles.
-    GLfloat *lightPositions = new GLfloat[Config::obstacleAmount * 3];
-    for (std::size_t i = 0; i < Config::obstacleAmount; i++) {
-        auto lightPosition = _obstacles.at(i)->lightPosition();
-        lightPositions[i * 3 + 0] = lightPosition.x;
-        lightPositions[i * 3 + 1] = lightPosition.y;
-        lightPositions[i * 3 + 2] = lightPosition.z;
-    }
-
-    // Get the moon direction for the lighting computations.
-    glm::vec3 moonDirection = _oceanAndSky->getMoonDirection();
+    // The window does not necessarily render into framebuffer 0.
+    _scene.render(defaultFramebufferObject(), &_profiler);
 
-    // Draw all drawables.
-    glEnable(GL_CULL_FACE);
-    glDepthFunc(GL_LESS);
-    for (auto drawable : _drawables) {
-        drawable->draw(_projectionMatrix, lightPositions, moonDirection);
+    // Paint the timings of the passes on top of the frame, QPainter allocates while the overlay is shown.
+    if (Config::showProfiler) {
+        QPainter painter(this);
+        ProfilerOverlay::paint(painter, _profiler, _scene.oceanQuality());
     }
 
-    // Unbind framebuffer, thus binding the default framebuffer again.
-    _postProcessing->unbind();
-    glDisable(GL_DEPTH_TEST);
-
-    // Set up view.
-    glClear(GL_COLOR_BUFFER_BIT);
-    // Set a background colour.
-    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-
-    // Draw the framebuffer.
-    _postProcessing->draw();
+    _paintAllocations.end();
 }
 
 void GLMainWindow::animateGL() {
     // Make the context current in case there are glFunctions called.
     makeCurrent();
 
-    // Get the time delta and restart the stopwatch.
-    float elapsedTimeMs = _stopWatch.nsecsElapsed() / 1000000.0f;
-    _stopWatch.restart();
+    // The update only uses storage owned by the window and the drawables, no heap allocations are expected.
+    _animateAllocations.begin();
 
-    // Calculate current model view matrix.
-    glm::mat4 modelViewMatrix =
-        lookAt(glm::vec3(0.0f, Config::lookAtHeight, 1.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    // Accumulate the time delta and restart the stopwatch.
+    _accumulatedTimeMs += _stopWatch.nsecsElapsed() / 1000000.0f;
+    _stopWatch.restart();
 
-    // Increment the animation looper if the animation is running.
-    const float incrementedLooper = Config::animationLooper + Config::animationSpeed;
-    Config::animationLooper = incrementedLooper > 1.0f ? 0.0f : incrementedLooper;
+    // Catch up with fixed simulation steps, the gameplay speed does not depend on the frame rate.
+    unsigned int steps = 0;
+    while (_accumulatedTimeMs >= Config::simulationStep && steps < Config::maxSimulationSteps) {
+        _scene.simulate();
+        _accumulatedTimeMs -= Config::simulationStep;
+        steps++;
+    }
 
-    // Update all drawables.
-    for (auto drawable : _drawables) {
-        drawable->update(elapsedTimeMs, modelViewMatrix);
+    // Drop the time the simulation could not catch up with, otherwise every late frame would make the next one later.
+    if (_accumulatedTimeMs >= Config::simulationStep) {
+        _accumulatedTimeMs = std::fmod(_accumulatedTimeMs, Config::simulationStep);
     }
 
+    // Place all drawables between their last two simulation steps.
+    _scene.update(_accumulatedTimeMs / Config::simulationStep);
+
+    _animateAllocations.end();
+
     // Update the window.
     update();
 }
@@ -228,7 +132,12 @@ void GLMainWindow::keyPressEvent(QKeyEvent *event) {
         else if (!_jumpSFX[2]->isPlaying())
             _jumpSFX[2]->play();
 
-        _billTheSalmon->flop();
+        // A flop after hitting an obstacle starts a new game with a new seed.
+        GameState &game = _scene.game();
+        if (game.isOver()) {
+            game.reset(std::random_device()());
+        }
+        game.flop();
     }
     // Pressing F in fullscreen mode will reset the window.
     else if (event->key() == Qt::Key_F && isFullscreen) {
@@ -242,6 +151,16 @@ void GLMainWindow::keyPressEvent(QKeyEvent *event) {
     else if (event->key() == Qt::Key_D) {
         Config::showHitbox = !Config::showHitbox;
     }
+    // Pressing P will toggle the timings of the render passes on/off.
+    else if (event->key() == Qt::Key_P) {
+        Config::showProfiler = !Config::showProfiler;
+    }
+    // Pressing T will save the timings of the last frames as a Chrome trace, to be opened in chrome://tracing.
+    else if (event->key() == Qt::Key_T) {
+        if (_profiler.writeChromeTrace("floppy.trace.json")) {
+            qDebug() << "Saved the trace of the last" << _profiler.frameAmount() << "frames to floppy.trace.json.";
+        }
+    }
     // Pressing R will toggle resolution scaling.
     else if (event->key() == Qt::Key_R) {
         if (Config::resolutionScale == 1)
@@ -250,6 +169,11 @@ void GLMainWindow::keyPressEvent(QKeyEvent *event) {
             Config::resolutionScale = 1;
         resizeGL(Config::windowWidth, Config::windowHeight);
     }
+    // Pressing O will cycle the resolution of the ocean through full, half and quarter.
+    else if (event->key() == Qt::Key_O) {
+        Config::oceanResolution = Config::oceanResolution >= 4 ? 1 : Config::oceanResolution * 2;
+        resizeGL(Config::windowWidth, Config::windowHeight);
+    }
     // Pressing + and - will increase or decrease the volume of the audio.
     else if (event->key() == Qt::Key_Plus) {
         if (Config::volume < 1.0f) Config::volume += 0.1f;
@@ -279,9 +203,16 @@ void GLMainWindow::keyPressEvent(QKeyEvent *event) {
         Config::fieldOfVision = 75.0f;
         resizeGL(Config::windowWidth, Config::windowHeight);
     }
+    // Pressing S will save the replay of the current game, FloppyHeadless --replay plays it back.
+    else if (event->key() == Qt::Key_S) {
+        if (_scene.game().replay().save("floppy.replay")) {
+            qDebug() << "Saved the replay of the current game to floppy.replay.";
+        }
+    }
     // Pressing ESCAPE or Q will quit everything.
     else if (event->key() == Qt::Key_Escape || event->key() == Qt::Key_Q) {
-        _postProcessing->destroy();
+        _scene.destroy();
+        _profiler.destroy();
         close();
     }
 }
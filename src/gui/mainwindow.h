@@ -9,30 +9,25 @@
 #include <src/drawables/drawable.h>
 
 #include <QElapsedTimer>
-#include <QOpenGLFunctions_4_1_Core>
 #include <QOpenGLWindow>
-#include <QTimer>
 #include <memory>
 
-#include "glm/ext/vector_float3.hpp"
-#include "src/drawables/fishController.h"
-#include "src/drawables/floppyMesh.h"
-#include "src/drawables/obstacles/obstacle.h"
-#include "src/drawables/postProcessing.h"
-#include "src/drawables/scene/ocean.h"
+#include "src/gui/passProfiler.h"
+#include "src/gui/sceneRenderer.h"
+#include "src/utils/allocationCounter.h"
 
 /**
  * @brief The GLWindow class handling the opengl window.
  */
-class GLMainWindow : public QOpenGLWindow, protected QOpenGLFunctions_4_1_Core {
+class GLMainWindow : public QOpenGLWindow {
     Q_OBJECT
 
    private slots:
     /**
      * @brief animateGL updates the scene
      *
-     * The new positions of all elements are generated.
-     * This is not used for drawing.
+     * Called after every swapped frame. The simulation advances in fixed steps for the time that passed,
+     * afterwards the elements are placed between their last two steps for drawing the next frame.
      */
     void animateGL();
 
@@ -77,19 +72,14 @@ class GLMainWindow : public QOpenGLWindow, protected QOpenGLFunctions_4_1_Core {
     void keyPressEvent(QKeyEvent* event) override;
 
    private:
-    glm::mat4 _projectionMatrix;                             /**< Projection Matrix */
-    std::shared_ptr<QSoundEffect> _jumpSFX[3];               /**< Jump SFX */
-    std::shared_ptr<QSoundEffect> _mediaPlayer;              /**< Media Player used for SFX */
-    std::shared_ptr<FloppyMesh> _billMesh;                   /**< Bill the salmon shown in the window */
-    std::shared_ptr<FloppyMesh> _secondProp;                 /**< A sign to test multi-parts objs */
-    std::shared_ptr<Ocean> _oceanAndSky;                     /**< Ocean and Sky Scene */
-    std::shared_ptr<FishController> _billTheSalmon;          /**< Bill the Salmon */
-    std::shared_ptr<PostProcessingQuad> _postProcessing;     /**< Post Processing framebuffer */
-    std::vector<std::shared_ptr<Drawable>> _drawables;       /**< Vector holding pointers to the drawables */
-    std::vector<std::shared_ptr<Obstacle>> _obstacles;       /**< Vector holding pointers to the obstacles */
-    std::vector<std::shared_ptr<glm::vec3>> _lightPositions; /**< Vector holding pointers to the light positions */
-    QTimer _updateTimer;                                     /**< Used for regular frame updates */
-    QElapsedTimer _stopWatch;                                /**< Measures time between updates */
+    SceneRenderer _scene;                       /**< The game and all drawables */
+    PassProfiler _profiler;                     /**< Measures the render passes of the last frames */
+    std::shared_ptr<QSoundEffect> _jumpSFX[3];  /**< Jump SFX */
+    std::shared_ptr<QSoundEffect> _mediaPlayer; /**< Media Player used for SFX */
+    QElapsedTimer _stopWatch;                   /**< Measures time between updates */
+    float _accumulatedTimeMs;                   /**< Time in ms not yet consumed by simulation steps */
+    AllocationTracker _paintAllocations;        /**< Counts the heap allocations of paintGL */
+    AllocationTracker _animateAllocations;      /**< Counts the heap allocations of animateGL */
 
     /**
      * @brief Updates the volume of all the audio sources in the application.
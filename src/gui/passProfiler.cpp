@@ -0,0 +1,194 @@
+#include "src/gui/passProfiler.h"
+
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "src/utils/utils.h"
+
+PassProfiler::PassProfiler(std::size_t historyCapacity)
+    : _queries{},
+      _inFlight{},
+      _isPending{},
+      _slot(0),
+      _frameIndex(0),
+      _droppedFrames(0),
+      _collectedFrames(0),
+      _gpuEpoch(0),
+      _gpuEpochTime(0.0),
+      _cpuEpoch(std::chrono::steady_clock::now()),
+      _history(std::max<std::size_t>(historyCapacity, 1)),
+      _historyStart(0),
+      _historySize(0) {}
+
+void PassProfiler::init() {
+    // Initialize OpenGL functions.
+    initializeOpenGLFunctions();
+
+    glGenQueries(sizeof(_queries) / sizeof(GLuint), &_queries[0][0][0]);
+
+    // Take the current GPU time, so the GPU timestamps can be placed on the CPU timeline.
+    GLint64 gpuTime = 0;
+    glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+    _gpuEpochTime = now();
+    _gpuEpoch = static_cast<GLuint64>(gpuTime);
+    glCheckError();
+}
+
+void PassProfiler::beginFrame() {
+    // The queries of this slot are reused, read back the frame that used them before if it finished.
+    _slot = _frameIndex % latency;
+    if (_isPending[_slot]) {
+        if (isAvailable(_slot)) {
+            collect(_slot);
+        } else {
+            _isPending[_slot] = false;
+            _droppedFrames++;
+        }
+    }
+    mark(frameSpan, false);
+}
+
+void PassProfiler::endFrame() {
+    mark(frameSpan, true);
+    _isPending[_slot] = true;
+    _frameIndex++;
+}
+
+void PassProfiler::finish() {
+    // Read back the frames in flight from the oldest to the newest, the results are waited for.
+    for (std::size_t i = 0; i < latency; i++) {
+        const std::size_t slot = (_frameIndex + i) % latency;
+        if (_isPending[slot]) {
+            collect(slot);
+        }
+    }
+}
+
+void PassProfiler::clear() {
+    _historyStart = 0;
+    _historySize = 0;
+}
+
+void PassProfiler::destroy() {
+    glDeleteQueries(sizeof(_queries) / sizeof(GLuint), &_queries[0][0][0]);
+    std::fill(&_queries[0][0][0], &_queries[0][0][0] + sizeof(_queries) / sizeof(GLuint), 0);
+    std::fill(_isPending, _isPending + latency, false);
+}
+
+const PassProfiler::FrameTiming& PassProfiler::frame(std::size_t index) const {
+    std::size_t position = _historyStart + index;
+    return _history[position < _history.size() ? position : position - _history.size()];
+}
+
+bool PassProfiler::writeChromeTrace(const std::string& filename) const {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (file == nullptr) {
+        qDebug() << "Could not open" << filename.c_str() << "for writing.";
+        return false;
+    }
+
+    // Name the two threads, the timestamps of the trace are in µs.
+    fprintf(file,
+            "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"
+            "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 1, \"args\": {\"name\": \"CPU\"}},\n"
+            "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 2, \"args\": {\"name\": \"GPU\"}}");
+    auto writeSpan = [file](const char* name, int thread, const Span& span) {
+        fprintf(file, ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}", name,
+                thread, span.begin * 1000.0, span.duration() * 1000.0);
+    };
+    for (std::size_t i = 0; i < _historySize; i++) {
+        const FrameTiming& timing = frame(i);
+        writeSpan("Frame", 1, timing.cpuFrame());
+        writeSpan("Frame", 2, timing.gpuFrame());
+        for (std::size_t pass = 0; pass < PassAmount; pass++) {
+            writeSpan(passName(static_cast<Pass>(pass)), 1, timing.cpu[pass]);
+            writeSpan(passName(static_cast<Pass>(pass)), 2, timing.gpu[pass]);
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    bool success = ferror(file) == 0;
+    success = fclose(file) == 0 && success;
+    if (!success) {
+        qDebug() << "Could not write" << filename.c_str();
+    }
+    return success;
+}
+
+const char* PassProfiler::passName(Pass pass) {
+    switch (pass) {
+        case Lights:
+            return "Lights";
+        case Ocean:
+            return "Ocean";
+        case Fish:
+            return "Fish";
+        case Obstacles:
+            return "Obstacles";
+        case Hitboxes:
+            return "Hitboxes";
+        case PostProcessing:
+            return "Post processing";
+        default:
+            return "Unknown";
+    }
+}
+
+PassProfiler::Percentiles PassProfiler::percentiles(std::vector<double>& samples) {
+    if (samples.empty()) {
+        return {0.0, 0.0, 0.0, 0.0, 0.0};
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto rank = [&samples](double percentile) {
+        const std::size_t index = static_cast<std::size_t>(std::ceil(percentile * samples.size()));
+        return samples[std::clamp<std::size_t>(index, 1, samples.size()) - 1];
+    };
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    return {sum / samples.size(), rank(0.5), rank(0.9), rank(0.99), samples.back()};
+}
+
+void PassProfiler::mark(std::size_t span, bool isEnd) {
+    Span& cpuSpan = _inFlight[_slot].cpu[span];
+    (isEnd ? cpuSpan.end : cpuSpan.begin) = now();
+    glQueryCounter(_queries[_slot][span][isEnd ? 1 : 0], GL_TIMESTAMP);
+}
+
+bool PassProfiler::isAvailable(std::size_t slot) {
+    // The end of the frame is the last query, it finishes after all others.
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(_queries[slot][frameSpan][1], GL_QUERY_RESULT_AVAILABLE, &available);
+    return available == GL_TRUE;
+}
+
+void PassProfiler::collect(std::size_t slot) {
+    FrameTiming& timing = _inFlight[slot];
+    for (std::size_t span = 0; span <= PassAmount; span++) {
+        double* ends[2] = {&timing.gpu[span].begin, &timing.gpu[span].end};
+        for (std::size_t end = 0; end < 2; end++) {
+            GLuint64 timestamp = 0;
+            glGetQueryObjectui64v(_queries[slot][span][end], GL_QUERY_RESULT, &timestamp);
+            *ends[end] = _gpuEpochTime + static_cast<double>(static_cast<std::int64_t>(timestamp - _gpuEpoch)) / 1e6;
+        }
+    }
+    _isPending[slot] = false;
+    _collectedFrames++;
+
+    // Append the frame to the history, overwriting the oldest frame once it is full.
+    if (_historySize < _history.size()) {
+        _history[(_historyStart + _historySize) % _history.size()] = timing;
+        _historySize++;
+    } else {
+        _history[_historyStart] = timing;
+        _historyStart = (_historyStart + 1) % _history.size();
+    }
+}
+
+double PassProfiler::now() const {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _cpuEpoch).count();
+}
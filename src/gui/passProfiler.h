@@ -0,0 +1,226 @@
+#ifndef PASS_PROFILER_H
+#define PASS_PROFILER_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Measures the CPU and GPU time of the render passes of every frame.
+ *
+ * The CPU time of a pass is the time spent issuing its commands, the GPU time is taken from timestamp queries at
+ * the start and the end of the pass. The queries live in a ring of slots, one per frame in flight, and a frame is
+ * only read back once its results are available. The profiler never waits for the GPU, if the results of a frame
+ * are not available when its slot is reused, the frame is dropped.
+ *
+ * The timings of the last frames are kept in a history of fixed capacity, which is read by the overlay and exported
+ * as a Chrome trace.
+ */
+class PassProfiler : protected QOpenGLFunctions_4_1_Core {
+   public:
+    /**
+     * @brief The render passes of a frame, in the order they are issued.
+     */
+    enum Pass { Lights, Ocean, Fish, Obstacles, Hitboxes, PostProcessing, PassAmount };
+
+    static constexpr std::size_t latency = 4; /**< Frames in flight before the queries of a frame are reused */
+
+    /**
+     * @brief A time span in ms.
+     */
+    struct Span {
+        double begin; /**< The start of the span */
+        double end;   /**< The end of the span */
+
+        double duration() const { return end - begin; }
+    };
+
+    /**
+     * @brief The spans of the passes and of the whole frame.
+     *
+     * Both are relative to the creation of the profiler, the GPU clock is related to the CPU clock once in init().
+     */
+    struct FrameTiming {
+        Span cpu[PassAmount + 1]; /**< CPU spans of the passes, followed by the span of the frame */
+        Span gpu[PassAmount + 1]; /**< GPU spans of the passes, followed by the span of the frame */
+
+        const Span& cpuFrame() const { return cpu[PassAmount]; }
+        const Span& gpuFrame() const { return gpu[PassAmount]; }
+    };
+
+    /**
+     * @brief Statistics of a series of samples.
+     */
+    struct Percentiles {
+        double mean; /**< Arithmetic mean */
+        double p50;  /**< Median */
+        double p90;  /**< 90th percentile */
+        double p99;  /**< 99th percentile */
+        double max;  /**< Maximum */
+    };
+
+    /**
+     * @brief Measures a pass from its construction to its destruction, does nothing without a profiler.
+     */
+    class Scope {
+       public:
+        /**
+         * @brief Marks the start of a pass.
+         * @param profiler - the profiler, may be null.
+         * @param pass - the pass.
+         */
+        Scope(PassProfiler* profiler, Pass pass) : _profiler(profiler), _pass(pass) {
+            if (_profiler != nullptr) {
+                _profiler->mark(_pass, false);
+            }
+        }
+
+        /**
+         * @brief Marks the end of the pass.
+         */
+        ~Scope() {
+            if (_profiler != nullptr) {
+                _profiler->mark(_pass, true);
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+       private:
+        PassProfiler* _profiler; /**< The profiler, null if profiling is disabled */
+        Pass _pass;              /**< The measured pass */
+    };
+
+    /**
+     * @brief Creates a profiler.
+     * @param historyCapacity - the amount of frames kept in the history, older frames are overwritten.
+     */
+    explicit PassProfiler(std::size_t historyCapacity);
+
+    /**
+     * @brief Creates the queries, requires a current OpenGL context.
+     */
+    void init();
+
+    /**
+     * @brief Marks the start of a frame, reads back the frame that used the same queries before.
+     */
+    void beginFrame();
+
+    /**
+     * @brief Marks the end of a frame, every pass has to be measured once per frame.
+     */
+    void endFrame();
+
+    /**
+     * @brief Waits for the GPU and reads back all frames still in flight, e.g. at the end of a benchmark.
+     */
+    void finish();
+
+    /**
+     * @brief Drops the history, e.g. the warm-up frames of a benchmark.
+     */
+    void clear();
+
+    /**
+     * @brief Deletes the queries.
+     */
+    void destroy();
+
+    /**
+     * @brief Returns the amount of frames in the history.
+     * @return the amount of frames.
+     */
+    std::size_t frameAmount() const { return _historySize; }
+
+    /**
+     * @brief Returns a frame of the history.
+     * @param index - the index of the frame, 0 is the oldest frame.
+     * @return the timings of the frame.
+     */
+    const FrameTiming& frame(std::size_t index) const;
+
+    /**
+     * @brief Returns the amount of frames dropped because their results were not available in time.
+     * @return the amount of frames.
+     */
+    std::uint64_t droppedFrames() const { return _droppedFrames; }
+
+    /**
+     * @brief Returns the amount of frames read back so far, grows whenever a new frame arrives in the history.
+     * @return the amount of frames.
+     */
+    std::uint64_t collectedFrames() const { return _collectedFrames; }
+
+    /**
+     * @brief Writes the history as a Chrome trace, which can be opened in chrome://tracing or Perfetto.
+     *
+     * The CPU and the GPU spans are written as two threads, with the frames as the outer spans of the passes.
+     * @param filename - the path of the trace.
+     * @return true if it was successful.
+     */
+    bool writeChromeTrace(const std::string& filename) const;
+
+    /**
+     * @brief Returns the name of a pass.
+     * @param pass - the pass.
+     * @return the name.
+     */
+    static const char* passName(Pass pass);
+
+    /**
+     * @brief Computes the statistics of a series of samples, the percentiles use the nearest rank.
+     * @param samples - the samples, reordered in place.
+     * @return the statistics, all 0 for no samples.
+     */
+    static Percentiles percentiles(std::vector<double>& samples);
+
+   private:
+    static constexpr std::size_t frameSpan = PassAmount; /**< Index of the span of the whole frame */
+
+    /**
+     * @brief Records the start or the end of a span on the CPU and on the GPU.
+     * @param span - the pass or frameSpan.
+     * @param isEnd - whether the end of the span is recorded.
+     */
+    void mark(std::size_t span, bool isEnd);
+
+    /**
+     * @brief Checks whether the results of a frame in flight are available.
+     * @param slot - the slot of the frame.
+     * @return true if all queries of the frame finished.
+     */
+    bool isAvailable(std::size_t slot);
+
+    /**
+     * @brief Reads back the queries of a frame in flight and appends it to the history.
+     * @param slot - the slot of the frame.
+     */
+    void collect(std::size_t slot);
+
+    /**
+     * @brief Returns the time since the creation of the profiler.
+     * @return the time in ms.
+     */
+    double now() const;
+
+    GLuint _queries[latency][PassAmount + 1][2];     /**< Timestamp queries at the start and end of every span */
+    FrameTiming _inFlight[latency];                  /**< The CPU timings of the frames in flight */
+    bool _isPending[latency];                        /**< Whether a slot holds a frame that was not read back */
+    std::size_t _slot;                               /**< The slot of the current frame */
+    std::uint64_t _frameIndex;                       /**< The amount of frames begun so far */
+    std::uint64_t _droppedFrames;                    /**< The amount of frames that were not read back in time */
+    std::uint64_t _collectedFrames;                  /**< The amount of frames read back */
+    GLuint64 _gpuEpoch;                              /**< A GPU timestamp taken in init(), in ns */
+    double _gpuEpochTime;                            /**< The CPU time at which the GPU epoch was taken, in ms */
+    std::chrono::steady_clock::time_point _cpuEpoch; /**< The creation of the profiler */
+    std::vector<FrameTiming> _history;               /**< Ring buffer of the timings of the last frames */
+    std::size_t _historyStart;                       /**< Index of the oldest frame in the history */
+    std::size_t _historySize;                        /**< Amount of frames in the history */
+};
+
+#endif  // PASS_PROFILER_H
@@ -0,0 +1,44 @@
+#include "src/gui/profilerOverlay.h"
+
+#include <QColor>
+#include <QFont>
+#include <QRect>
+#include <QString>
+#include <algorithm>
+
+namespace ProfilerOverlay {
+
+void paint(QPainter& painter, const PassProfiler& profiler, float oceanQuality) {
+    // Average the newest frames, a single frame is too noisy to read.
+    const std::size_t frameAmount = std::min(rollingFrames, profiler.frameAmount());
+    double cpuTimes[PassProfiler::PassAmount + 1] = {};
+    double gpuTimes[PassProfiler::PassAmount + 1] = {};
+    for (std::size_t i = profiler.frameAmount() - frameAmount; i < profiler.frameAmount(); i++) {
+        const PassProfiler::FrameTiming& timing = profiler.frame(i);
+        for (std::size_t span = 0; span <= PassProfiler::PassAmount; span++) {
+            cpuTimes[span] += timing.cpu[span].duration() / frameAmount;
+            gpuTimes[span] += timing.gpu[span].duration() / frameAmount;
+        }
+    }
+
+    // One row per pass and one for the whole frame, below a header and above the ocean quality.
+    const int lineHeight = 16;
+    const int rowAmount = PassProfiler::PassAmount + 3;
+    QFont font("monospace");
+    font.setStyleHint(QFont::Monospace);
+    font.setPointSize(10);
+    painter.setFont(font);
+    painter.fillRect(QRect(8, 8, 300, rowAmount * lineHeight + 8), QColor(0, 0, 0, 160));
+    painter.setPen(QColor(255, 255, 255));
+    painter.drawText(16, 8 + lineHeight, QString::asprintf("%-16s %8s %8s", "Pass", "GPU ms", "CPU ms"));
+    for (std::size_t span = 0; span <= PassProfiler::PassAmount; span++) {
+        const char* name =
+            span < PassProfiler::PassAmount ? PassProfiler::passName(static_cast<PassProfiler::Pass>(span)) : "Frame";
+        painter.drawText(16, 8 + static_cast<int>(span + 2) * lineHeight,
+                         QString::asprintf("%-16s %8.3f %8.3f", name, gpuTimes[span], cpuTimes[span]));
+    }
+    painter.drawText(16, 8 + rowAmount * lineHeight, QString::asprintf("%-16s %7.0f%%", "Ocean quality",
+                                                                       oceanQuality * 100.0f));
+}
+
+}  // namespace ProfilerOverlay
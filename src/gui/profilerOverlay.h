@@ -0,0 +1,25 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include <QPainter>
+#include <cstddef>
+
+#include "src/gui/passProfiler.h"
+
+namespace ProfilerOverlay {
+
+constexpr std::size_t rollingFrames = 60; /**< Amount of the newest frames averaged by the overlay */
+
+/**
+ * @brief Paints the rolling average of the CPU and GPU time of every pass and the ocean quality in the top left corner.
+ *
+ * QPainter changes the OpenGL state, the overlay has to be painted after the scene.
+ * @param painter - the painter of the window.
+ * @param profiler - the profiler measuring the frames.
+ * @param oceanQuality - the quality of the ocean in [0, 1].
+ */
+void paint(QPainter& painter, const PassProfiler& profiler, float oceanQuality);
+
+}  // namespace ProfilerOverlay
+
+#endif  // PROFILER_OVERLAY_H
@@ -0,0 +1,27 @@
+#include "src/gui/qualityController.h"
+
+#include <algorithm>
+
+QualityController::QualityController(float quality)
+    : _quality(std::clamp(quality, 0.0f, 1.0f)), _averageMs(0.0), _remainingHold(0) {}
+
+void QualityController::addSample(double frameMs, double budgetMs) {
+    _averageMs = _averageMs == 0.0 ? frameMs : _averageMs + (frameMs - _averageMs) * smoothing;
+    if (budgetMs <= 0.0) {
+        return;
+    }
+
+    if (_remainingHold > 0) {
+        _remainingHold--;
+    }
+    const double load = _averageMs / budgetMs;
+    if (load > 1.0 && _remainingHold == 0) {
+        // Drop fast, a frame over the budget is a dropped frame.
+        const float overshoot = static_cast<float>(std::min(load - 1.0, 1.0));
+        _quality = std::max(_quality - minimumDecrease - decreaseRate * overshoot, 0.0f);
+        _remainingHold = holdSamples;
+    } else if (load < recoveryThreshold) {
+        // Recover slowly, so the quality settles below the budget.
+        _quality = std::min(_quality + increaseRate, 1.0f);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef QUALITY_CONTROLLER_H
+#define QUALITY_CONTROLLER_H
+
+/**
+ * @brief Adapts a quality level in [0, 1] to keep the GPU time of a frame within a budget.
+ *
+ * The measured frame times are smoothed, as single frames are noisy and arrive a few frames late. Over the budget
+ * the quality drops in proportion to the overshoot and then holds until the drop shows in the measurements. Well
+ * below the budget it slowly recovers, the gap between both thresholds keeps it from oscillating.
+ */
+class QualityController {
+   public:
+    static constexpr float decreaseRate = 0.1f;      /**< Quality dropped per sample at twice the budget */
+    static constexpr float minimumDecrease = 0.01f;  /**< Quality dropped per sample just over the budget */
+    static constexpr float increaseRate = 0.005f;    /**< Quality regained per sample below the recovery threshold */
+    static constexpr double recoveryThreshold = 0.8; /**< Fraction of the budget below which the quality recovers */
+    static constexpr double smoothing = 0.2;         /**< Weight of a new sample in the smoothed frame time */
+    static constexpr unsigned int holdSamples = 6;   /**< Samples without a further drop after a drop */
+
+    /**
+     * @brief Creates a controller.
+     * @param quality - the initial quality level.
+     */
+    explicit QualityController(float quality = 1.0f);
+
+    /**
+     * @brief Adds the measured GPU time of a frame and adapts the quality level.
+     * @param frameMs - the GPU time of the frame in ms.
+     * @param budgetMs - the GPU time a frame may take in ms, 0 keeps the quality level.
+     */
+    void addSample(double frameMs, double budgetMs);
+
+    /**
+     * @brief Returns the current quality level.
+     * @return the quality level in [0, 1].
+     */
+    float quality() const { return _quality; }
+
+    /**
+     * @brief Returns the smoothed GPU time of a frame.
+     * @return the time in ms, 0 before the first sample.
+     */
+    double averageMs() const { return _averageMs; }
+
+   private:
+    float _quality;              /**< The current quality level */
+    double _averageMs;           /**< The smoothed GPU time of a frame */
+    unsigned int _remainingHold; /**< Samples until the quality may drop again */
+};
+
+#endif  // QUALITY_CONTROLLER_H
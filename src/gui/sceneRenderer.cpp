@@ -0,0 +1,255 @@
+#define GLM_FORCE_RADIANS
+
+#include "src/gui/sceneRenderer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+#include "glm/ext/matrix_clip_space.hpp"
+#include "glm/ext/matrix_transform.hpp"
+#include "glm/ext/vector_float3.hpp"
+#include "src/config/config.h"
+#include "src/drawables/meshCache.h"
+#include "src/drawables/shaderProgramCache.h"
+#include "src/drawables/textureCache.h"
+#include "src/drawables/textureLoader.h"
+
+SceneRenderer::SceneRenderer()
+    : _projectionMatrix(1.0f),
+      _viewMatrix(1.0f),
+      _interpolation(0.0f),
+      _width(Config::windowWidth),
+      _height(Config::windowHeight),
+      _oceanQuality(Config::oceanQuality),
+      _collectedFrames(0) {
+    // Create all the drawables.
+    _billMesh = std::make_shared<FloppyMesh>("res/BillDerLachs.obj", 2.0f, 90.0f);
+
+    _drawables = {
+        // The ocean background.
+        _oceanAndSky = std::make_shared<Ocean>(),
+        _oceanUpsampler = std::make_shared<OceanUpsampler>(),
+        // Bill the Salmon.
+        _billTheSalmon = std::make_shared<FishController>(_game.fish(), _billMesh),
+        // All obstacles, drawn straight from the simulated course.
+        _obstacles = std::make_shared<ObstacleRenderer>(_game.obstacles()),
+        _postProcessing = std::make_shared<PostProcessingQuad>(),
+    };
+}
+
+void SceneRenderer::init() {
+    // Initialize OpenGL functions, replacing glewInit().
+    initializeOpenGLFunctions();
+
+    // Set up the state shared by all passes.
+    applyState();
+
+    // Create the uniform buffer holding the per-frame data and the light grid.
+    _frameUniforms.init();
+    _lightGrid.init();
+
+    // Initialize all drawables, their textures are decoded in the background meanwhile.
+    for (auto drawable : _drawables) {
+        drawable->init();
+    }
+    _oceanAndSky->setQuality(_oceanQuality.quality());
+
+    // The first frame shows complete textures.
+    TextureLoader::finish();
+    TextureCache::report();
+}
+
+void SceneRenderer::resize(int width, int height) {
+    // Update the viewport.
+    _width = width;
+    _height = height;
+    glViewport(0, 0, _width, _height);
+
+    // Store the resolution in the config.
+    Config::windowWidth = width;
+    Config::windowHeight = height;
+
+    // Calculate projection matrix from current resolution, this allows for resizing the window without distortion.
+    const float aspect = float(Config::windowWidth) / float(Config::windowHeight);
+    _projectionMatrix = glm::perspective(glm::radians(Config::fieldOfVision), aspect, 0.1f, 100.0f);
+
+    _postProcessing->resetBufferTextures(width * Config::resolutionScale, height * Config::resolutionScale);
+    _oceanUpsampler->resize(_width, _height, Config::oceanResolution);
+}
+
+void SceneRenderer::simulate() {
+    // Increment the animation looper if the animation is running.
+    const float incrementedLooper = Config::animationLooper + Config::animationSpeed;
+    Config::animationLooper = incrementedLooper > 1.0f ? 0.0f : incrementedLooper;
+
+    // Advance the game and the animations of all drawables by one step.
+    _game.step();
+    Config::currentScore = _game.score();
+    for (auto drawable : _drawables) {
+        drawable->simulate(Config::simulationStep);
+    }
+}
+
+void SceneRenderer::update(float interpolation) {
+    // Calculate current view matrix, it is the model view matrix of the root of the scene.
+    _viewMatrix = lookAt(glm::vec3(0.0f, Config::lookAtHeight, 1.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    // Update all drawables between their last two simulation steps, the obstacles refill their batches with the
+    // instances of this frame.
+    _interpolation = interpolation;
+    for (auto drawable : _drawables) {
+        drawable->update(_interpolation, _viewMatrix);
+    }
+}
+
+void SceneRenderer::render(GLuint targetFramebuffer, PassProfiler* profiler) {
+    if (profiler != nullptr) {
+        profiler->beginFrame();
+        adaptQuality(*profiler);
+    }
+
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::Lights);
+
+        // Restore the state other users of the context, e.g. an overlay painted by QPainter, may have changed.
+        applyState();
+
+        // Bind framebuffer.
+        _postProcessing->bind();
+        glEnable(GL_DEPTH_TEST);
+        // Set up view.
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        // Set a background colour.
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cout << "Framebuffer is incomplete: " << std::to_string(glCheckFramebufferStatus(GL_FRAMEBUFFER))
+                      << std::endl;
+        }
+
+        // Bin the lights of all obstacles into the tiles of the viewport, the lighting is computed in view space.
+        // The obstacles write their lights straight into the light grid.
+        const ObstacleCourse& obstacles = _game.obstacles();
+        _lightGrid.clearLights();
+        obstacles.writeLights(_interpolation, _viewMatrix, Config::lightRadius,
+                              _lightGrid.addLights(obstacles.size()));
+        _lightGrid.update(_projectionMatrix, Config::windowWidth, Config::windowHeight);
+        _lightGrid.bind();
+
+        // Gather the per-frame data and upload it once for all programs.
+        _frameData.projectionMatrix = _projectionMatrix;
+        _frameData.viewMatrix = _viewMatrix;
+        _frameData.moonDirection = _oceanAndSky->getMoonDirection();
+        _frameData.elapsedTime = _oceanAndSky->getElapsedTime();
+        _frameData.lightTileAmount = _lightGrid.tileAmount();
+        _frameData.lightTileSize = LightGrid::tileSize;
+        _frameUniforms.update(_frameData);
+    }
+
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::Ocean);
+
+        // Disable culling and set a less strict depth function.
+        glDisable(GL_CULL_FACE);
+        glDepthFunc(GL_LEQUAL);
+        if (_oceanUpsampler->divisor() > 1) {
+            // Shade the ocean at the reduced resolution and upsample it at the far plane, below the meshes.
+            _oceanUpsampler->bind();
+            _oceanAndSky->draw();
+            _postProcessing->bind();
+            glViewport(0, 0, _width, _height);
+            _oceanUpsampler->draw();
+        } else {
+            _oceanAndSky->draw();
+        }
+    }
+
+    // Draw the fish and the obstacles, the ocean and the post processing quad are drawn separately.
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::Fish);
+        glEnable(GL_CULL_FACE);
+        glDepthFunc(GL_LESS);
+        _billTheSalmon->draw();
+    }
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::Obstacles);
+        _obstacles->draw();
+    }
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::Hitboxes);
+        _obstacles->drawHitboxes();
+    }
+
+    {
+        PassProfiler::Scope scope(profiler, PassProfiler::PostProcessing);
+
+        // Bind the target framebuffer again.
+        _postProcessing->unbind(targetFramebuffer);
+        glDisable(GL_DEPTH_TEST);
+
+        // Set up view.
+        glClear(GL_COLOR_BUFFER_BIT);
+        // Set a background colour.
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+        // Draw the framebuffer.
+        _postProcessing->draw();
+    }
+
+    if (profiler != nullptr) {
+        profiler->endFrame();
+    }
+}
+
+void SceneRenderer::applyState() {
+    // Update the viewport.
+    glViewport(0, 0, _width, _height);
+
+    // Enable depth test.
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+
+    // Enable multisampling for AA;
+    glEnable(GL_MULTISAMPLE);
+
+    // Enable SRGB framebuffer.
+    glEnable(GL_FRAMEBUFFER_SRGB);
+
+    // Enable alpha blending and selecting blend function.
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO);
+
+    // Draw filled polygons into all channels, without clipping.
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_SCISSOR_TEST);
+    glDisable(GL_STENCIL_TEST);
+}
+
+void SceneRenderer::adaptQuality(const PassProfiler& profiler) {
+    // The newest frames are at the end of the history, the history may have been cleared meanwhile.
+    const std::size_t newFrames =
+        static_cast<std::size_t>(std::min<std::uint64_t>(profiler.collectedFrames() - _collectedFrames,
+                                                         profiler.frameAmount()));
+    for (std::size_t i = profiler.frameAmount() - newFrames; i < profiler.frameAmount(); i++) {
+        _oceanQuality.addSample(profiler.frame(i).gpuFrame().duration(), Config::gpuBudget);
+    }
+    _collectedFrames = profiler.collectedFrames();
+    _oceanAndSky->setQuality(_oceanQuality.quality());
+}
+
+void SceneRenderer::destroy() {
+    _postProcessing->destroy();
+    _oceanUpsampler->destroy();
+    _obstacles->destroy();
+    _frameUniforms.destroy();
+    _lightGrid.destroy();
+    TextureLoader::clear();
+    MeshCache::clear();
+    TextureCache::clear();
+    ShaderProgramCache::clear();
+}
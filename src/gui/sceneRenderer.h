@@ -0,0 +1,114 @@
+#ifndef SCENE_RENDERER_H
+#define SCENE_RENDERER_H
+
+#include <QOpenGLFunctions_4_1_Core>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "glm/ext/matrix_float4x4.hpp"
+#include "src/core/gameState.h"
+#include "src/drawables/drawable.h"
+#include "src/drawables/fishController.h"
+#include "src/drawables/floppyMesh.h"
+#include "src/drawables/frameUniforms.h"
+#include "src/drawables/lightGrid.h"
+#include "src/drawables/obstacles/obstacleRenderer.h"
+#include "src/drawables/postProcessing.h"
+#include "src/drawables/scene/ocean.h"
+#include "src/drawables/scene/oceanUpsampler.h"
+#include "src/gui/passProfiler.h"
+#include "src/gui/qualityController.h"
+
+/**
+ * @brief The game and all its drawables, renders a frame into any framebuffer.
+ *
+ * The renderer does not depend on a window, it renders into the window as well as into an offscreen framebuffer.
+ * The scene is drawn into the framebuffer of the PostProcessingQuad, which is then drawn into the target framebuffer.
+ * With a profiler, the quality of the ocean adapts to the GPU time of the frames and Config::gpuBudget.
+ * The ocean is shaded at 1/Config::oceanResolution of the resolution and upsampled before the meshes are drawn.
+ */
+class SceneRenderer : protected QOpenGLFunctions_4_1_Core {
+   public:
+    /**
+     * @brief Creates the game and all drawables.
+     */
+    SceneRenderer();
+
+    /**
+     * @brief Sets up the OpenGL state and initializes all drawables, requires a current OpenGL context.
+     */
+    void init();
+
+    /**
+     * @brief Adapts the viewport, the projection and the framebuffers of the ocean and the post processing to a new
+     * resolution, the ocean follows Config::oceanResolution.
+     * @param width - the width of the target framebuffer.
+     * @param height - the height of the target framebuffer.
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Advances the game and the animations of all drawables by one fixed simulation step.
+     */
+    void simulate();
+
+    /**
+     * @brief Places all drawables between their last two simulation steps.
+     * @param interpolation - the progress of the frame between the last two steps, in [0, 1).
+     */
+    void update(float interpolation);
+
+    /**
+     * @brief Renders a frame.
+     * @param targetFramebuffer - the framebuffer receiving the post processed frame.
+     * @param profiler - measures the passes of the frame if not null.
+     */
+    void render(GLuint targetFramebuffer, PassProfiler* profiler = nullptr);
+
+    /**
+     * @brief Deletes the framebuffers and buffers of the scene and the cached meshes.
+     */
+    void destroy();
+
+    GameState& game() { return _game; }
+
+    /**
+     * @brief Returns the current quality of the ocean.
+     * @return the quality level in [0, 1].
+     */
+    float oceanQuality() const { return _oceanQuality.quality(); }
+
+   private:
+    /**
+     * @brief Sets the viewport and the fixed state shared by all passes.
+     */
+    void applyState();
+
+    /**
+     * @brief Feeds the frames read back since the last call into the quality controller and updates the ocean.
+     * @param profiler - the profiler measuring the frames.
+     */
+    void adaptQuality(const PassProfiler& profiler);
+
+    glm::mat4 _projectionMatrix;                         /**< Projection Matrix */
+    glm::mat4 _viewMatrix;                               /**< View Matrix */
+    float _interpolation;                                /**< Progress of the frame between the last two steps */
+    int _width;                                          /**< Width of the target framebuffer */
+    int _height;                                         /**< Height of the target framebuffer */
+    GameState _game;                                     /**< The simulated game, read by the drawables */
+    FrameData _frameData;                                /**< The per-frame data shared by all programs */
+    FrameUniforms _frameUniforms;                        /**< The uniform buffer holding the per-frame data */
+    std::shared_ptr<FloppyMesh> _billMesh;               /**< Bill the salmon shown in the window */
+    std::shared_ptr<Ocean> _oceanAndSky;                 /**< Ocean and Sky Scene */
+    std::shared_ptr<OceanUpsampler> _oceanUpsampler;     /**< Ocean at a reduced resolution */
+    std::shared_ptr<FishController> _billTheSalmon;      /**< Bill the Salmon */
+    std::shared_ptr<PostProcessingQuad> _postProcessing; /**< Post Processing framebuffer */
+    std::shared_ptr<ObstacleRenderer> _obstacles;        /**< Draws the meshes and hitboxes of all obstacles */
+    std::vector<std::shared_ptr<Drawable>> _drawables;   /**< Vector holding pointers to the drawables */
+    LightGrid _lightGrid;                                /**< The lights of the obstacles binned into tiles */
+    QualityController _oceanQuality;                     /**< Adapts the quality of the ocean to the GPU budget */
+    std::uint64_t _collectedFrames;                      /**< The frames of the profiler fed into the controller */
+};
+
+#endif  // SCENE_RENDERER_H
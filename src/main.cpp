@@ -1,27 +1,80 @@
 #include <QColorSpace>
 #include <QSurfaceFormat>
 #include <QtWidgets/QApplication>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 
+#include "gui/frameBenchmark.h"
 #include "gui/mainwindow.h"
+#include "src/config/config.h"
 
 int main(int argc, char *argv[]) {
-    QGuiApplication app(argc, argv);
+    // With --bench-frames the scene is rendered offscreen for the given amount of frames instead of opening a window,
+    // --bench-trace saves the measured frames as a Chrome trace.
+    // --gpu-budget sets the GPU time per frame in ms the ocean adapts to and --ocean-quality its initial quality.
+    // --ocean-resolution renders the ocean at 1/N of the resolution, the benchmark compares 1, 2 and 4 with "all".
+    unsigned int benchFrames = 0;
+    std::string benchTracePath;
+    const char *gpuBudget = nullptr;
+    bool allOceanResolutions = false;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--bench-frames") == 0) {
+            benchFrames = std::strtoul(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--bench-trace") == 0) {
+            benchTracePath = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--gpu-budget") == 0) {
+            gpuBudget = argv[i + 1];
+        } else if (std::strcmp(argv[i], "--ocean-quality") == 0) {
+            Config::oceanQuality = std::strtof(argv[i + 1], nullptr);
+        } else if (std::strcmp(argv[i], "--ocean-resolution") == 0) {
+            allOceanResolutions = std::strcmp(argv[i + 1], "all") == 0;
+            if (!allOceanResolutions) {
+                Config::oceanResolution = std::max(std::strtoul(argv[i + 1], nullptr, 10), 1ul);
+            }
+        }
+    }
+
+    // The benchmark keeps the ocean quality fixed, so its runs stay comparable, unless a budget was given.
+    if (gpuBudget != nullptr) {
+        Config::gpuBudget = std::strtof(gpuBudget, nullptr);
+    } else if (benchFrames > 0) {
+        Config::gpuBudget = 0.0f;
+    }
 
-    // Seed the random number generator with the current time.
-    std::srand(std::time(nullptr));
+    // The benchmark needs no window system, unless a platform was chosen explicitly.
+    if (benchFrames > 0 && qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    QGuiApplication app(argc, argv);
 
     // Set gl format.
     QSurfaceFormat glFormat;
     glFormat.setSwapBehavior(QSurfaceFormat::DoubleBuffer);
-    glFormat.setSwapInterval(::getenv("COREGL_FPS") ? 0 : 1);
+    glFormat.setSwapInterval(::getenv("COREGL_FPS") || benchFrames > 0 ? 0 : 1);
     glFormat.setVersion(4, 1);
     glFormat.setProfile(QSurfaceFormat::CoreProfile);
     glFormat.setSamples(8);
     glFormat.setColorSpace(QColorSpace::NamedColorSpace::SRgb);
     glFormat.setDepthBufferSize(24);
-    glFormat.setOption(QSurfaceFormat::DebugContext);
+    // The debug context slows down every call, it would distort the benchmark.
+    if (benchFrames == 0) {
+        glFormat.setOption(QSurfaceFormat::DebugContext);
+    }
     QSurfaceFormat::setDefaultFormat(glFormat);
 
+    if (benchFrames > 0) {
+        std::vector<unsigned int> oceanResolutions = {Config::oceanResolution};
+        if (allOceanResolutions) {
+            oceanResolutions = {1, 2, 4};
+        }
+        return FrameBenchmark::run(benchFrames, Config::windowWidth, Config::windowHeight, benchTracePath,
+                                   oceanResolutions);
+    }
+
     // Load the main window.
     GLMainWindow mainWindow;
     mainWindow.show();
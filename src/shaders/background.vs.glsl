@@ -1,6 +1,7 @@
 #version 410 core
 
-uniform mat4 projection_matrix;
+#include "frameData.glsl"
+
 uniform mat4 modelview_matrix;
 
 // Get position from vertex array object.
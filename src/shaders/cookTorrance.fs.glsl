@@ -1,15 +1,18 @@
 #version 410 core
 
-// NOTE: this must be the same as Config::obstacleAmount
-#define NUM_LIGHTS 5
+#include "frameData.glsl"
 
 // Get values from vertex shader.
 smooth in vec2 vTexCoords;
 smooth in vec3 vNormal;
 smooth in vec3 vView;
+smooth in vec3 vPosition;
 
-smooth in float vLightDistance[NUM_LIGHTS];
-smooth in vec3 vLightDir[NUM_LIGHTS];
+// Point lights binned into screen tiles by the LightGrid.
+// The lights hold the view space position and the radius, the tiles the first index and the amount of indices.
+uniform samplerBuffer light_data;
+uniform usamplerBuffer light_tiles;
+uniform usamplerBuffer light_indices;
 
 // Primary texture mostly used for albedo.
 uniform sampler2D albedo;
@@ -22,7 +25,6 @@ uniform vec3 emissiveColour;
 uniform float eta;
 
 const float moon_distance = 100.0f;
-uniform vec3 moon_direction;
 const vec3 moon_light_colour = vec3(0.45f, 0.65f, 1.0f) * 10000.0f;
 
 const vec3 lightColour = vec3(1.0f, 0.6f, 0.4f) * 16.0f;
@@ -107,17 +109,26 @@ void main(void)
     // Viewing direction, aka. Omega_out.
     vec3 view_vec = normalize(vView);
 
+    // Only evaluate the point lights reaching the tile of this fragment.
+    ivec2 tile = clamp(ivec2(gl_FragCoord.xy) / light_tile_size, ivec2(0), light_tile_amount - 1);
+    uvec2 light_range = texelFetch(light_tiles, tile.y * light_tile_amount.x + tile.x).rg;
+
     fColour = vec4(0.0f);
-    for (int i = 0; i < NUM_LIGHTS; i++) {
+    for (uint i = 0u; i < light_range.y; i++) {
+        vec4 light = texelFetch(light_data, int(texelFetch(light_indices, int(light_range.x + i)).r));
+
         // Direction towards the light, aka. -Omega_in.
-        vec3 light_vec = normalize(vLightDir[i]);
+        vec3 to_light = light.xyz - vPosition;
+        float light_distance = length(to_light);
+        vec3 light_vec = to_light / light_distance;
 
-        // Attenuate the light source.
+        // Attenuate the light source, the window fades it out smoothly until its radius.
         float a_quadratic_attenuation_term = 1.6f;
         float b_linear_attenuation_term = 8.0f;
-        float attenuation = b_linear_attenuation_term * vLightDistance[i] + 1.0f;
-        attenuation += a_quadratic_attenuation_term * vLightDistance[i] * vLightDistance[i];
-        vec3 attenuated_light = lightColour / attenuation;
+        float attenuation = b_linear_attenuation_term * light_distance + 1.0f;
+        attenuation += a_quadratic_attenuation_term * light_distance * light_distance;
+        float window = clamp(1.0f - pow(light_distance / light.w, 4.0f), 0.0f, 1.0f);
+        vec3 attenuated_light = lightColour * window * window / attenuation;
 
         // Incorporate illumination from the light.
         vec3 colourCookTorrance = cook_torrance(textureColour.rgb, materialSpecularColour, normal, light_vec, view_vec, attenuated_light);
@@ -0,0 +1,37 @@
+#version 410 core
+
+#include "frameData.glsl"
+
+// Get position from vertex array object.
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 texCoords;
+
+// Get the model view matrix per instance, it occupies the locations 3 to 6.
+layout(location = 3) in mat4 instance_modelview_matrix;
+
+// Send texture coordinates and lighting values to fragment shader.
+smooth out vec2 vTexCoords;
+smooth out vec3 vNormal;
+smooth out vec3 vView;
+smooth out vec3 vPosition;
+
+void main(void)
+{
+    // Calculate position in model view projection space.
+    vec4 worldPosition = vec4(instance_modelview_matrix * vec4(position, 1.0f));
+
+    // Pass the generated texture coords to the FS.
+    vTexCoords = texCoords;
+
+    // Normal per vertex.
+    vNormal = normalize(vec3(inverse(transpose(instance_modelview_matrix)) * vec4(normal, 0)));
+
+    // View vector / direction. Due to the camera being at 0 in the view-space it is 0-Position.
+    vView = normalize(-(vec3(worldPosition.x, worldPosition.y, worldPosition.z) / worldPosition.w));
+
+    // Position in view space, the point lights are evaluated per fragment.
+    vPosition = worldPosition.xyz / worldPosition.w;
+
+    gl_Position = projection_matrix * worldPosition;
+}
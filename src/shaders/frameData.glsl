@@ -0,0 +1,10 @@
+// Per-frame data shared by all programs, updated once per frame.
+// NOTE: this must be the same as FrameData in src/drawables/frameUniforms.h
+layout(std140) uniform FrameData {
+    mat4 projection_matrix;
+    mat4 view_matrix;
+    vec3 moon_direction;
+    float elapsed_time;
+    ivec2 light_tile_amount;
+    int light_tile_size;
+};
@@ -6,15 +6,19 @@
 #define DRAG_MULT 0.38 // changes how much waves pull on the water
 #define WATER_DEPTH 1.0 // how deep is the water
 #define CAMERA_HEIGHT 1.5 // how high the camera should be
-#define ITERATIONS_RAYMARCH 12 // waves iterations of raymarching
-#define ITERATIONS_NORMAL 36 // waves iterations when calculating normals
+#define MIN_OCTAVES 3 // waves iterations kept at any distance
+#define OCTAVE_FALLOFF 0.05 // how fast the waves iterations fall off with the distance
+
+#include "frameData.glsl"
 
 uniform mat4 sky_rotation_matrix;
 
+// The quality of the water, adapted to the GPU budget at runtime.
+uniform int raymarch_steps; // maximum steps of raymarching
+uniform int raymarch_iterations; // waves iterations of raymarching
+uniform int normal_iterations; // waves iterations when calculating normals
+
 uniform samplerCube skybox_texture;
-uniform float elapsed_time;
-uniform vec2 resolution;
-uniform vec3 moon_direction;
 
 // Send colour to screen.
 layout (location = 0) out vec4 fcolour;
@@ -65,13 +69,20 @@ float getwaves(vec2 position, int iterations) {
     return sumOfValues / sumOfWeights;
 }
 
+// Reduces the waves iterations with the distance, the high frequencies of far waves are smaller than a pixel.
+int octaves(int iterations, float dist) {
+    return max(min(iterations, MIN_OCTAVES), int(float(iterations) / (1.0 + dist * OCTAVE_FALLOFF)));
+}
+
 // Raymarches the ray from top water layer boundary to low water layer boundary.
 float raymarchwater(vec3 camera, vec3 start, vec3 end, float depth) {
     vec3 pos = start;
     vec3 dir = normalize(end - start);
-    for (int i = 0; i < 64; i++) {
+    // The iterations stay the same along the ray, so the height field does not change between the steps.
+    int iterations = octaves(raymarch_iterations, distance(start, camera));
+    for (int i = 0; i < raymarch_steps; i++) {
         // The height is from 0 to -depth.
-        float height = getwaves(pos.xz, ITERATIONS_RAYMARCH) * depth - depth;
+        float height = getwaves(pos.xz, iterations) * depth - depth;
         // Ff the waves height almost nearly matches the ray height, assume its a hit and return the hit distance.
         if (height + 0.01 > pos.y) {
             return distance(pos, camera);
@@ -85,14 +96,14 @@ float raymarchwater(vec3 camera, vec3 start, vec3 end, float depth) {
 }
 
 // Calculate normal at point by calculating the height at the pos and 2 additional points very close to pos.
-vec3 normal(vec2 pos, float e, float depth) {
+vec3 normal(vec2 pos, float e, float depth, int iterations) {
     vec2 ex = vec2(e, 0);
-    float H = getwaves(pos.xy, ITERATIONS_NORMAL) * depth;
+    float H = getwaves(pos.xy, iterations) * depth;
     vec3 a = vec3(pos.x, H, pos.y);
     return normalize(
         cross(
-            a - vec3(pos.x - e, getwaves(pos.xy - ex.xy, ITERATIONS_NORMAL) * depth, pos.y),
-            a - vec3(pos.x, getwaves(pos.xy + ex.yx, ITERATIONS_NORMAL) * depth, pos.y + e)
+            a - vec3(pos.x - e, getwaves(pos.xy - ex.xy, iterations) * depth, pos.y),
+            a - vec3(pos.x, getwaves(pos.xy + ex.yx, iterations) * depth, pos.y + e)
         )
     );
 }
@@ -182,8 +193,8 @@ void main(void) {
     float dist = raymarchwater(origin, highHitPos, lowHitPos, WATER_DEPTH);
     vec3 waterHitPos = origin + ray * dist;
 
-    // Calculate normal at the hit position.
-    vec3 N = normal(waterHitPos.xz, 0.01, WATER_DEPTH);
+    // Calculate normal at the hit position, far normals are smoothed below anyway.
+    vec3 N = normal(waterHitPos.xz, 0.01, WATER_DEPTH, octaves(normal_iterations, dist));
 
     // Sooth the normal with distance to avoid disturbing high frequency noise.
     N = mix(N, vec3(0.0, 1.0, 0.0), 0.8 * min(1.0, sqrt(dist * 0.01) * 1.1));
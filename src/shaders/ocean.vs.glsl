@@ -1,7 +1,6 @@
 #version 410 core
 
-uniform mat4 projection_matrix;
-uniform mat4 modelview_matrix;
+#include "frameData.glsl"
 
 // Get position from vertex array object.
 layout (location = 0) in vec3 position;
@@ -13,8 +12,8 @@ smooth out vec3 sky_direction;
 void main(void)
 {
     // Calculate position in model view projection space.
-    vec4 positionVC = vec4(modelview_matrix * vec4(10.0f * position, 1.0f));
-    direction = vec3(inverse(modelview_matrix) * vec4(positionVC));
+    vec4 positionVC = vec4(view_matrix * vec4(10.0f * position, 1.0f));
+    direction = vec3(inverse(view_matrix) * vec4(positionVC));
 
 
     positionVC = projection_matrix * positionVC;
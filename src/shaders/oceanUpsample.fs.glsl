@@ -0,0 +1,71 @@
+#version 410 core
+
+#define CAMERA_HEIGHT 1.5 // how high the camera of the ocean is, as in ocean.fs.glsl
+#define SKYBOX_SIZE 10.0 // half the edge length of the cube drawn by the ocean
+#define SHARPNESS 32.0 // how strongly texels across an edge of the guide are rejected
+
+#include "frameData.glsl"
+
+uniform sampler2D ocean_buffer; // the ocean at the reduced resolution
+uniform vec2 viewport_size; // size of the full resolution viewport in pixels
+
+// Send colour to the framebuffer of the scene.
+layout (location = 0) out vec4 fcolour;
+
+// Get the direction the ocean shades at a position of the viewport in [0, 1].
+// The ocean draws a cube around the origin and shades the direction from the origin to the cube, not from the camera.
+vec3 oceanRay(vec2 uv) {
+    mat3 inverse_rotation = transpose(mat3(view_matrix));
+    vec3 camera = -(inverse_rotation * view_matrix[3].xyz);
+    vec2 device = uv * 2.0 - 1.0;
+    vec3 view = inverse_rotation * vec3(device.x / projection_matrix[0][0], device.y / projection_matrix[1][1], -1.0);
+
+    // Leave the cube through the nearest face, a face parallel to the view is never reached.
+    vec3 exits = (SKYBOX_SIZE - camera * sign(view)) / abs(view);
+    float exit = min(exits.x, min(exits.y, exits.z));
+    return normalize(camera + view * exit);
+}
+
+// Get the guide of the filter, 1 for the sky and the inverse distance to the water in (-1, 0) for the water.
+float guide(vec3 ray) {
+    if (ray.y >= 0.0) {
+        return 1.0;
+    }
+    return -1.0 / (1.0 + CAMERA_HEIGHT / -ray.y);
+}
+
+// Main.
+void main(void) {
+    vec2 uv = gl_FragCoord.xy / viewport_size;
+    float pixel_guide = guide(oceanRay(uv));
+
+    // Find the four texels around the pixel.
+    ivec2 size = textureSize(ocean_buffer, 0);
+    vec2 texel = uv * vec2(size) - 0.5;
+    ivec2 base = ivec2(floor(texel));
+    vec2 blend = texel - vec2(base);
+
+    // Weight the texels bilinearly and by how closely their guide matches the one of the pixel.
+    vec3 colour = vec3(0.0);
+    float weight_sum = 0.0;
+    vec3 closest_colour = vec3(0.0);
+    float closest_difference = 1e9;
+    for (int i = 0; i < 4; i++) {
+        ivec2 offset = ivec2(i & 1, i >> 1);
+        ivec2 coords = clamp(base + offset, ivec2(0), size - 1);
+        vec3 texel_colour = texelFetch(ocean_buffer, coords, 0).rgb;
+        float difference = abs(guide(oceanRay((vec2(coords) + 0.5) / vec2(size))) - pixel_guide);
+        vec2 bilinear = mix(1.0 - blend, blend, vec2(offset));
+        float weight = bilinear.x * bilinear.y * exp(-SHARPNESS * difference);
+        colour += texel_colour * weight;
+        weight_sum += weight;
+        if (difference < closest_difference) {
+            closest_difference = difference;
+            closest_colour = texel_colour;
+        }
+    }
+
+    // A thin feature, e.g. the horizon, may be missed by all texels, take the one matching best.
+    colour = weight_sum > 1e-4 ? colour / weight_sum : closest_colour;
+    fcolour = vec4(colour, 1.0);
+}
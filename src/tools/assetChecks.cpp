@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "lib/tinyobj/tiny_obj_loader.h"
+#include "src/utils/bakedTexture.h"
+#include "src/utils/blockCompression.h"
+#include "src/utils/meshLoader.h"
+
+/**
+ * Creates an RGBA8888 image with a different gradient in every channel.
+ * @param width - the width of the image in pixels.
+ * @param height - the height of the image in pixels.
+ * @return the pixels, row by row from the top.
+ */
+static std::vector<std::uint8_t> gradient(std::uint32_t width, std::uint32_t height) {
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4);
+    for (std::uint32_t y = 0; y < height; y++) {
+        for (std::uint32_t x = 0; x < width; x++) {
+            std::uint8_t* pixel = pixels.data() + (static_cast<std::size_t>(y) * width + x) * 4;
+            pixel[0] = static_cast<std::uint8_t>(x * 255 / (width - 1));
+            pixel[1] = static_cast<std::uint8_t>(y * 255 / (height - 1));
+            pixel[2] = static_cast<std::uint8_t>((x + y) * 255 / (width + height - 2));
+            pixel[3] = static_cast<std::uint8_t>(255 - x * 255 / (width - 1));
+        }
+    }
+    return pixels;
+}
+
+/**
+ * Checks that an image survives compressing and decompressing within an error bound per channel.
+ * @param name - the name of the format, used in the report.
+ * @param format - the format.
+ * @param maxError - the largest allowed difference per channel, -1 for the channels the format drops, which decode
+ * to 0 and alpha to opaque.
+ * @return true if the check passed.
+ */
+static bool checkRoundTrip(const char *name, BlockCompression::Format format, const int (&maxError)[4]) {
+    // An odd size leaves partial blocks at the right and bottom border.
+    const std::uint32_t width = 13;
+    const std::uint32_t height = 7;
+    const std::vector<std::uint8_t> pixels = gradient(width, height);
+    std::vector<std::uint8_t> blocks(BlockCompression::compressedSize(format, width, height));
+    BlockCompression::compress(format, pixels.data(), width, height, blocks.data());
+    std::vector<std::uint8_t> decompressed(pixels.size());
+    BlockCompression::decompress(format, blocks.data(), width, height, decompressed.data());
+
+    int error[4] = {0, 0, 0, 0};
+    bool passed = true;
+    for (std::size_t i = 0; i < pixels.size(); i++) {
+        const int channel = static_cast<int>(i % 4);
+        const bool dropped = maxError[channel] < 0;
+        const int expected = !dropped ? pixels[i] : (channel == 3 ? 255 : 0);
+        error[channel] = std::max(error[channel], std::abs(decompressed[i] - expected));
+        passed = passed && error[channel] <= std::max(maxError[channel], 0);
+    }
+    printf("%s %s of %ux%u, largest error per channel %d %d %d %d.\n", passed ? "Passed" : "FAILED", name, width,
+           height, error[0], error[1], error[2], error[3]);
+    return passed;
+}
+
+/**
+ * Checks that a baked texture reads back with its full mip chain and the blocks of the image.
+ * @param path - the path of the temporary blob.
+ * @return true if the check passed.
+ */
+static bool checkBakedTexture(const std::string& path) {
+    const std::uint32_t width = 13;
+    const std::uint32_t height = 7;
+    const std::vector<std::uint8_t> pixels = gradient(width, height);
+    if (!BakedTexture::save(path, BlockCompression::Bc3, true, pixels.data(), width, height)) {
+        printf("FAILED a baked texture reads back: cannot save the blob.\n");
+        return false;
+    }
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BakedTexture::View view;
+    if (!BakedTexture::read(data.data(), data.size(), view) || view.format != BlockCompression::Bc3 || !view.srgb) {
+        printf("FAILED a baked texture reads back: the blob is rejected or its format differs.\n");
+        return false;
+    }
+
+    // The largest level holds the blocks of the image, every further level halves it down to 1x1.
+    std::vector<std::uint8_t> blocks(BlockCompression::compressedSize(BlockCompression::Bc3, width, height));
+    BlockCompression::compress(BlockCompression::Bc3, pixels.data(), width, height, blocks.data());
+    bool passed = !view.levels.empty() && view.levels[0].size == blocks.size() &&
+                  std::equal(blocks.begin(), blocks.end(), view.levels[0].data);
+    std::uint32_t levelWidth = width, levelHeight = height;
+    for (const BakedTexture::LevelView& level : view.levels) {
+        passed = passed && level.width == levelWidth && level.height == levelHeight &&
+                 level.size == BlockCompression::compressedSize(BlockCompression::Bc3, levelWidth, levelHeight);
+        levelWidth = std::max(levelWidth / 2, 1u);
+        levelHeight = std::max(levelHeight / 2, 1u);
+    }
+    passed = passed && view.levels.size() == 4 && view.levels.back().width == 1 && view.levels.back().height == 1;
+    printf("%s a baked texture reads back, %zu levels down to %ux%u.\n", passed ? "Passed" : "FAILED",
+           view.levels.size(), view.levels.empty() ? 0 : view.levels.back().width,
+           view.levels.empty() ? 0 : view.levels.back().height);
+    return passed;
+}
+
+/**
+ * Whether a welded vertex stands for a face corner, -0 and +0 count as equal.
+ * @param welded - the welded vertex.
+ * @param corner - the vertex packed from the attributes of the face corner.
+ * @return true if the vertex has the attributes of the corner.
+ */
+static bool sameCorner(const Vertex& welded, const Vertex& corner) {
+    auto sameHalf = [](std::uint16_t first, std::uint16_t second) {
+        return first == second || ((first | second) & 0x7FFF) == 0;
+    };
+    return welded.position.x == corner.position.x && welded.position.y == corner.position.y &&
+           welded.position.z == corner.position.z && welded.normal == corner.normal &&
+           sameHalf(welded.textureCoordinate[0], corner.textureCoordinate[0]) &&
+           sameHalf(welded.textureCoordinate[1], corner.textureCoordinate[1]);
+}
+
+/**
+ * Checks that the welded vertices of an obj reproduce all its face corners without duplicates, with 16-bit indices
+ * wherever they fit.
+ * @param path - the path of the obj.
+ * @param expectedVertices - the expected amount of welded vertices, 0 to skip the comparison.
+ * @return true if the check passed.
+ */
+static bool checkWelding(const std::string& path, std::size_t expectedVertices) {
+    MeshData mesh;
+    tinyobj::ObjReader reader;
+    if (!MeshLoader::loadObj(path, mesh) || !reader.ParseFromFile(path) ||
+        reader.GetShapes().size() != mesh.parts.size()) {
+        printf("FAILED welding %s: cannot load the obj.\n", path.c_str());
+        return false;
+    }
+    const tinyobj::attrib_t& attributes = reader.GetAttrib();
+
+    bool passed = expectedVertices == 0 || mesh.vertices.size() == expectedVertices;
+    std::size_t corners = 0;
+    for (std::size_t part = 0; part < mesh.parts.size(); part++) {
+        const MeshRange& range = mesh.parts[part];
+        const std::vector<tinyobj::index_t>& indices = reader.GetShapes()[part].mesh.indices;
+        passed = passed && range.indexSize == (range.vertexAmount <= 65536 ? 2u : 4u) &&
+                 range.indexOffset % range.indexSize == 0 && range.indexAmount == indices.size();
+
+        // Every corner has to index a vertex of its part with its own attributes.
+        for (std::size_t i = 0; passed && i < indices.size(); i++) {
+            std::uint32_t index = 0;
+            std::memcpy(&index, mesh.indices.data() + range.indexOffset + i * range.indexSize, range.indexSize);
+            const tinyobj::index_t& corner = indices[i];
+            const float* position = &attributes.vertices[3 * corner.vertex_index];
+            const glm::vec3 normal = corner.normal_index >= 0
+                                         ? glm::vec3(attributes.normals[3 * corner.normal_index + 0],
+                                                     attributes.normals[3 * corner.normal_index + 1],
+                                                     attributes.normals[3 * corner.normal_index + 2])
+                                         : glm::vec3(0.0f);
+            const glm::vec2 textureCoordinate =
+                corner.texcoord_index >= 0 ? glm::vec2(attributes.texcoords[2 * corner.texcoord_index + 0],
+                                                       attributes.texcoords[2 * corner.texcoord_index + 1])
+                                           : glm::vec2(0.0f);
+            passed = index < range.vertexAmount &&
+                     sameCorner(mesh.vertices[range.baseVertex + index],
+                                Vertex(glm::vec3(position[0], position[1], position[2]), normal, textureCoordinate));
+        }
+        corners += indices.size();
+
+        // No two vertices of a part may be bitwise equal, they would have been welded.
+        std::set<std::string> vertices;
+        for (std::size_t i = 0; passed && i < range.vertexAmount; i++) {
+            const Vertex& vertex = mesh.vertices[range.baseVertex + i];
+            passed = vertices.emplace(reinterpret_cast<const char*>(&vertex), sizeof(Vertex)).second;
+        }
+    }
+    passed = passed && corners == mesh.cornerAmount;
+    printf("%s welding %s, %zu face corners into %zu vertices.\n", passed ? "Passed" : "FAILED", path.c_str(),
+           corners, mesh.vertices.size());
+    return passed;
+}
+
+/**
+ * Checks of the asset formats, run by ctest.
+ * Usage: FloppyAssetChecks, from the source directory
+ */
+int main() {
+    // The colours of a block span a plane while the end points of BC1 only fit a line through them, the single
+    // channels of BC3 and BC4 only lose their quantization.
+    bool passed = checkRoundTrip("BC1", BlockCompression::Bc1, {48, 48, 48, -1});
+    passed = checkRoundTrip("BC3", BlockCompression::Bc3, {48, 48, 48, 8}) && passed;
+    passed = checkRoundTrip("BC4", BlockCompression::Bc4, {8, -1, -1, -1}) && passed;
+
+    const std::string texturePath = (std::filesystem::temp_directory_path() / "floppyAssetChecks.ftex").string();
+    passed = checkBakedTexture(texturePath) && passed;
+    std::filesystem::remove(texturePath);
+
+    for (const char *path : {"res/BillDerLachs.obj", "res/Lamp.obj", "res/Sign.obj"}) {
+        passed = checkWelding(path, 0) && passed;
+    }
+
+    // Two triangles whose corners only differ in the sign of their zeros weld into a single triangle.
+    const std::string meshPath = (std::filesystem::temp_directory_path() / "floppyAssetChecks.obj").string();
+    std::ofstream(meshPath) << "v 0 0 0\nv -0 1 0\nv 1 0 0\nv 0 1 0\nv 1 -0 -0\n"
+                               "vn 0 0 1\nvn -0 -0 1\nvt 0 0\nvt -0 -0\n"
+                               "f 1/1/1 2/1/1 3/1/1\nf 1/2/2 4/2/1 5/1/2\n";
+    passed = checkWelding(meshPath, 3) && passed;
+    std::filesystem::remove(meshPath);
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,336 @@
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "src/core/autopilot.h"
+#include "src/core/collision.h"
+#include "src/core/gameState.h"
+#include "src/core/replay.h"
+
+/**
+ * Plays a game without any input until it ends or the tick limit is reached.
+ * @param seed - the seed of the game.
+ * @param flopInterval - the fish flops every flopInterval ticks, never if 0.
+ * @param ticks - the tick limit.
+ * @return the game at its end.
+ */
+static GameState play(std::uint32_t seed, unsigned int flopInterval, std::uint64_t ticks) {
+    GameState game(seed);
+    while (!game.isOver() && game.tick() < ticks) {
+        if (flopInterval != 0 && game.tick() % flopInterval == 0) {
+            game.flop();
+        }
+        game.step();
+    }
+    return game;
+}
+
+/**
+ * Plays a game with a bot until it ends or the tick limit is reached.
+ * @param seed - the seed of the game.
+ * @param shouldFlop - decides whether the fish flops before the next step.
+ * @param ticks - the tick limit.
+ * @return the game at its end.
+ */
+static GameState playBot(std::uint32_t seed, bool (*shouldFlop)(const GameState&), std::uint64_t ticks) {
+    GameState game(seed);
+    while (!game.isOver() && game.tick() < ticks) {
+        if (shouldFlop(game)) {
+            game.flop();
+        }
+        game.step();
+    }
+    return game;
+}
+
+/**
+ * Returns the first obstacle the fish has not passed yet.
+ * @param game - the game.
+ * @return the obstacle.
+ */
+static ObstacleState nextObstacle(const GameState& game) {
+    const ObstacleCourse& obstacles = game.obstacles();
+    std::size_t order = 0;
+    while (order + 1 < obstacles.size() && obstacles.fromLeft(order).x < game.fish().position().x) {
+        order++;
+    }
+    return obstacles.fromLeft(order);
+}
+
+/**
+ * A bot that keeps the fish just above the top of the gap of the next obstacle.
+ * @param game - the game.
+ * @return true if the fish should flop before the next step.
+ */
+static bool flopAboveGap(const GameState& game) {
+    const FishState& fish = game.fish();
+    return fish.verticalVelocity() <= 0.0f && fish.position().y < nextObstacle(game).gapTop() + 0.01f;
+}
+
+/**
+ * Checks that a game that leaves the playfield ends without a score.
+ * @param name - the name of the check, used in the report.
+ * @param flopInterval - the fish flops every flopInterval ticks, never if 0.
+ * @return true if the check passed.
+ */
+static bool checkLeavesPlayfield(const char *name, unsigned int flopInterval) {
+    const std::uint64_t ticks = 20000;
+    bool passed = true;
+    for (std::uint32_t seed = 0; seed < 100; seed++) {
+        GameState game = play(seed, flopInterval, ticks);
+        if (!game.isOver() || game.score() != 0) {
+            printf("FAILED %s: seed %u is %s after %llu ticks with score %u, the fish is at y %.3f.\n", name, seed,
+                   game.isOver() ? "over" : "not over", static_cast<unsigned long long>(game.tick()), game.score(),
+                   game.fish().position().y);
+            passed = false;
+        }
+    }
+    if (passed) {
+        printf("Passed %s.\n", name);
+    }
+    return passed;
+}
+
+/**
+ * Checks that the autopilot scores, so the gap is passable at all.
+ * @return true if the check passed.
+ */
+static bool checkAutopilotScores() {
+    bool passed = true;
+    for (std::uint32_t seed = 0; seed < 100; seed++) {
+        GameState game = playBot(seed, Autopilot::shouldFlop, 20000);
+        if (game.score() == 0) {
+            printf("FAILED the autopilot scores: seed %u ends after %llu ticks without a point.\n", seed,
+                   static_cast<unsigned long long>(game.tick()));
+            passed = false;
+        }
+    }
+    if (passed) {
+        printf("Passed the autopilot scores.\n");
+    }
+    return passed;
+}
+
+/**
+ * Checks that the gap includes its edges only, and that a fish held just above the gap does not score.
+ * @return true if the check passed.
+ */
+static bool checkAboveGap() {
+    bool passed = true;
+    for (std::uint32_t seed = 0; seed < 100; seed++) {
+        const ObstacleState obstacle = GameState(seed).obstacles()[0];
+        if (!obstacle.gapContains(obstacle.gapTop()) || !obstacle.gapContains(obstacle.gapBottom()) ||
+            obstacle.gapContains(std::nextafter(obstacle.gapTop(), 2.0f)) ||
+            obstacle.gapContains(std::nextafter(obstacle.gapBottom(), -1.0f))) {
+            printf("FAILED a fish above the gap does not score: seed %u has the gap [%.3f, %.3f] without its edges.\n",
+                   seed, obstacle.gapBottom(), obstacle.gapTop());
+            passed = false;
+        }
+
+        GameState game = playBot(seed, flopAboveGap, 20000);
+        if (!game.isOver() || game.score() != 0) {
+            printf("FAILED a fish above the gap does not score: seed %u is %s after %llu ticks with score %u.\n", seed,
+                   game.isOver() ? "over" : "not over", static_cast<unsigned long long>(game.tick()), game.score());
+            passed = false;
+        }
+    }
+    if (passed) {
+        printf("Passed a fish above the gap does not score.\n");
+    }
+    return passed;
+}
+
+/**
+ * Checks the result of sweeping a box against another one.
+ * @param name - the name of the case, used in the report.
+ * @param moving - the moving box at the start of the step.
+ * @param displacement - the displacement of the moving box over the step.
+ * @param target - the static box.
+ * @param hit - whether the boxes are expected to overlap during the step.
+ * @param time - the expected time of impact, only checked if they overlap.
+ * @return true if the case passed.
+ */
+static bool expectSweep(const char *name, const BoundingBox& moving, const glm::vec2& displacement,
+                        const BoundingBox& target, bool hit, float time) {
+    float actualTime = -1.0f;
+    const bool actualHit = Collision::sweep(moving, displacement, target, actualTime);
+    if (actualHit != hit || (hit && std::abs(actualTime - time) > 1e-6f)) {
+        printf("FAILED the sweep %s: %s at time %f, expected %s at time %f.\n", name, actualHit ? "hit" : "no hit",
+               actualTime, hit ? "a hit" : "no hit", time);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Checks the continuous collision detection of two boxes.
+ * @return true if the check passed.
+ */
+static bool checkSweep() {
+    // A fish sized box and the hitbox of an obstacle part, 0.1 wide.
+    const BoundingBox obstacle{glm::vec2(0.0f, 0.0f), glm::vec2(0.05f, 0.5f)};
+    const BoundingBox box{glm::vec2(-1.0f, 0.0f), glm::vec2(0.25f, 0.08f)};
+    const BoundingBox unit{glm::vec2(0.0f, 0.0f), glm::vec2(0.5f, 0.5f)};
+
+    // The box moves by 2 in one step, 20 times the width of the obstacle, and enters it after (1 - 0.3) / 2.
+    bool passed = expectSweep("does not tunnel", box, glm::vec2(2.0f, 0.0f), obstacle, true, 0.35f);
+    passed = expectSweep("does not tunnel diagonally", box, glm::vec2(2.0f, 0.2f), obstacle, true, 0.35f) && passed;
+    passed = expectSweep("misses above", box, glm::vec2(2.0f, 0.0f),
+                         BoundingBox{glm::vec2(0.0f, 1.0f), glm::vec2(0.05f, 0.5f)}, false, 0.0f) &&
+             passed;
+
+    // Boxes touching at the start, at the end or along the way do not overlap.
+    const BoundingBox left{glm::vec2(-1.0f, 0.0f), glm::vec2(0.5f, 0.5f)};
+    const BoundingBox below{glm::vec2(-2.0f, -1.0f), glm::vec2(0.5f, 0.5f)};
+    passed = expectSweep("touching at rest", left, glm::vec2(0.0f, 0.0f), unit, false, 0.0f) && passed;
+    passed = expectSweep("touching moving away", left, glm::vec2(-1.0f, 0.0f), unit, false, 0.0f) && passed;
+    passed = expectSweep("touching sliding along", left, glm::vec2(0.0f, 1.0f), unit, false, 0.0f) && passed;
+    passed = expectSweep("touching at the end", below, glm::vec2(1.0f, 0.0f),
+                         BoundingBox{glm::vec2(0.0f, -1.0f), glm::vec2(0.5f, 0.5f)}, false, 0.0f) &&
+             passed;
+    passed = expectSweep("touching at a corner", BoundingBox{glm::vec2(-2.0f, 0.0f), glm::vec2(0.5f, 0.5f)},
+                         glm::vec2(2.0f, -2.0f), unit, false, 0.0f) &&
+             passed;
+
+    // Boxes overlapping at the start hit at once, whether and where they move.
+    const BoundingBox inside{glm::vec2(0.2f, 0.1f), glm::vec2(0.1f, 0.1f)};
+    passed = expectSweep("overlapping at rest", inside, glm::vec2(0.0f, 0.0f), unit, true, 0.0f) && passed;
+    passed = expectSweep("overlapping moving out", inside, glm::vec2(3.0f, 0.0f), unit, true, 0.0f) && passed;
+
+    // Without displacement boxes apart stay apart.
+    passed = expectSweep("apart at rest", box, glm::vec2(0.0f, 0.0f), obstacle, false, 0.0f) && passed;
+
+    if (passed) {
+        printf("Passed the sweep.\n");
+    }
+    return passed;
+}
+
+/**
+ * The observable state of a game after a step.
+ */
+struct Snapshot {
+    std::uint64_t tick;      /**< The amount of simulated ticks */
+    unsigned int score;      /**< The score */
+    bool over;               /**< Whether the game is over */
+    std::uint32_t fishBitsY; /**< The bits of the y-coordinate of the fish */
+};
+
+/**
+ * Takes the snapshot of a game.
+ * @param game - the game.
+ * @return the snapshot.
+ */
+static Snapshot snapshot(const GameState& game) {
+    return {game.tick(), game.score(), game.isOver(), std::bit_cast<std::uint32_t>(game.fish().position().y)};
+}
+
+/**
+ * Checks that a saved and loaded replay reproduces every step of the recorded game bit-exactly.
+ * @param path - the path of the temporary replay.
+ * @return true if the check passed.
+ */
+static bool checkReplayRoundTrip(const std::string& path) {
+    bool passed = true;
+    for (std::uint32_t seed = 0; seed < 20; seed++) {
+        // Record the autopilot and the state after every step.
+        GameState recorded(seed);
+        std::vector<Snapshot> snapshots;
+        while (!recorded.isOver() && recorded.tick() < 20000) {
+            if (Autopilot::shouldFlop(recorded)) {
+                recorded.flop();
+            }
+            recorded.step();
+            snapshots.push_back(snapshot(recorded));
+        }
+
+        Replay replay;
+        if (!recorded.replay().save(path) || !replay.load(path) || replay.seed() != seed ||
+            replay.length() != recorded.tick() || replay.flopTicks() != recorded.replay().flopTicks()) {
+            printf("FAILED a replay reproduces its game: seed %u does not survive saving and loading.\n", seed);
+            passed = false;
+            continue;
+        }
+
+        // Replay the loaded flops tick by tick, the same way Replay::play does.
+        GameState game(replay.seed());
+        std::size_t flop = 0;
+        for (const Snapshot& expected : snapshots) {
+            if (flop < replay.flopTicks().size() && replay.flopTicks()[flop] == game.tick()) {
+                game.flop();
+                flop++;
+            }
+            game.step();
+            const Snapshot actual = snapshot(game);
+            if (actual.tick != expected.tick || actual.score != expected.score || actual.over != expected.over ||
+                actual.fishBitsY != expected.fishBitsY) {
+                printf("FAILED a replay reproduces its game: seed %u differs at tick %llu, score %u instead of %u, "
+                       "the fish at y %a instead of %a.\n",
+                       seed, static_cast<unsigned long long>(expected.tick), actual.score, expected.score,
+                       std::bit_cast<float>(actual.fishBitsY), std::bit_cast<float>(expected.fishBitsY));
+                passed = false;
+                break;
+            }
+        }
+    }
+    if (passed) {
+        printf("Passed a replay reproduces its game.\n");
+    }
+    return passed;
+}
+
+/**
+ * Checks that loading rejects every truncation of a replay and leaves the replay unchanged.
+ * @param path - the path of the temporary replay.
+ * @return true if the check passed.
+ */
+static bool checkTruncatedReplay(const std::string& path) {
+    GameState game = playBot(7, Autopilot::shouldFlop, 20000);
+    if (!game.replay().save(path)) {
+        printf("FAILED a truncated replay is rejected: cannot save the replay.\n");
+        return false;
+    }
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    bool passed = true;
+    for (std::size_t size = 0; size < data.size(); size++) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(data.data(), static_cast<std::streamsize>(size));
+        Replay replay;
+        replay.start(1234);
+        if (replay.load(path) || replay.seed() != 1234) {
+            printf("FAILED a truncated replay is rejected: %zu of %zu bytes are loaded.\n", size, data.size());
+            passed = false;
+        }
+    }
+    if (passed) {
+        printf("Passed a truncated replay is rejected.\n");
+    }
+    return passed;
+}
+
+/**
+ * Checks of the simulation core, run by ctest.
+ * Usage: FloppyCoreChecks
+ */
+int main() {
+    bool passed = checkLeavesPlayfield("a game without flops ends with score 0", 0);
+    passed = checkLeavesPlayfield("a game flopping every tick ends with score 0", 1) && passed;
+    passed = checkAutopilotScores() && passed;
+    passed = checkAboveGap() && passed;
+    passed = checkSweep() && passed;
+
+    const std::string replayPath = (std::filesystem::temp_directory_path() / "floppyCoreChecks.replay").string();
+    passed = checkReplayRoundTrip(replayPath) && passed;
+    passed = checkTruncatedReplay(replayPath) && passed;
+    std::filesystem::remove(replayPath);
+    return passed ? 0 : 1;
+}
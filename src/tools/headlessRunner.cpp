@@ -0,0 +1,94 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "src/core/autopilot.h"
+#include "src/core/gameState.h"
+#include "src/core/replay.h"
+
+/**
+ * Plays a recorded game as fast as possible and prints its result.
+ * @param filename - the path of the replay.
+ * @return the exit code.
+ */
+static int playReplay(const char *filename) {
+    Replay replay;
+    if (!replay.load(filename)) {
+        return 1;
+    }
+
+    GameState game(replay.seed());
+    auto start = std::chrono::steady_clock::now();
+    replay.play(game);
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+    printf("Replayed seed %u with %zu flops in %.6f s: score %u after %llu ticks", replay.seed(),
+           replay.flopTicks().size(), seconds.count(), game.score(), static_cast<unsigned long long>(game.tick()));
+    if (game.isOver()) {
+        printf(", hit an obstacle at tick %.4f", game.impactTick());
+    }
+    printf(".\n");
+    return 0;
+}
+
+/**
+ * Headless simulation runner, plays games with a simple bot as fast as possible without any display.
+ * A game ends when the fish hits an obstacle or after the given amount of ticks. Game i is seeded with seed + i,
+ * the replay of the game with the best score can be saved.
+ * Usage: FloppyHeadless [games] [ticks per game] [seed] [best replay]
+ *        FloppyHeadless --replay <replay>
+ */
+int main(int argc, char *argv[]) {
+    if (argc == 3 && std::strcmp(argv[1], "--replay") == 0) {
+        return playReplay(argv[2]);
+    }
+
+    const unsigned long games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    const unsigned long ticks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+    const std::uint32_t seed = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 0;
+    const char *bestReplayPath = argc > 4 ? argv[4] : nullptr;
+    if (games == 0 || ticks == 0) {
+        fprintf(stderr, "Usage: %s [games] [ticks per game] [seed] [best replay]\n", argv[0]);
+        fprintf(stderr, "       %s --replay <replay>\n", argv[0]);
+        return 1;
+    }
+
+    GameState game(seed);
+    Replay bestReplay;
+    unsigned int bestScore = 0;
+    unsigned long long totalScore = 0;
+    unsigned long long totalTicks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < games; i++) {
+        game.reset(seed + static_cast<std::uint32_t>(i));
+        // Play until the fish hits an obstacle or the tick limit is reached.
+        while (!game.isOver() && game.tick() < ticks) {
+            if (Autopilot::shouldFlop(game)) {
+                game.flop();
+            }
+            game.step();
+        }
+        totalScore += game.score();
+        totalTicks += game.tick();
+        if (bestReplayPath != nullptr && (i == 0 || game.score() > bestScore)) {
+            bestScore = game.score();
+            bestReplay = game.replay();
+        }
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+    printf("Simulated %lu games of at most %lu ticks in %.3f s: %.0f ticks/s, %.1f games/s.\n", games, ticks,
+           seconds.count(), totalTicks / seconds.count(), games / seconds.count());
+    printf("Mean score %.2f, mean length %.1f ticks.\n", static_cast<double>(totalScore) / static_cast<double>(games),
+           static_cast<double>(totalTicks) / static_cast<double>(games));
+
+    if (bestReplayPath != nullptr) {
+        if (!bestReplay.save(bestReplayPath)) {
+            return 1;
+        }
+        printf("Saved the replay of seed %u with score %u to %s.\n", bestReplay.seed(), bestScore, bestReplayPath);
+    }
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include <cstdio>
+
+#include "src/utils/bakedMesh.h"
+#include "src/utils/meshLoader.h"
+
+/**
+ * Offline mesh baker, converts an obj and its materials into a binary blob.
+ * Usage: FloppyMeshBaker <input.obj> <output.fmesh>
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <input.obj> <output.fmesh>\n", argv[0]);
+        return 1;
+    }
+
+    MeshData mesh;
+    if (!MeshLoader::loadObj(argv[1], mesh) || !BakedMesh::save(argv[2], mesh)) {
+        return 1;
+    }
+
+    printf("Baked %s: %zu vertices, %zu bytes of indices, %zu parts.\n", argv[1], mesh.vertices.size(),
+           mesh.indices.size(), mesh.parts.size());
+    return 0;
+}
@@ -0,0 +1,56 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "src/utils/bakedTexture.h"
+#include "src/utils/imageTexture.h"
+
+/**
+ * Offline texture baker, compresses an image and its mip chain into a binary blob.
+ * The type matches Drawable::TextureType: srgb and rgb colours become BC1, or BC3 if they are not opaque,
+ * normal maps become linear BC1 and monochrome images become BC4.
+ * Usage: FloppyTextureBaker [--type srgb|rgb|normal|mono] <input.png> <output.ftex>
+ */
+int main(int argc, char *argv[]) {
+    std::string type = "srgb";
+    int argument = 1;
+    if (argc == 5 && std::strcmp(argv[1], "--type") == 0) {
+        type = argv[2];
+        argument = 3;
+    }
+    if (argc - argument != 2 || (type != "srgb" && type != "rgb" && type != "normal" && type != "mono")) {
+        fprintf(stderr, "Usage: %s [--type srgb|rgb|normal|mono] <input.png> <output.ftex>\n", argv[0]);
+        return 1;
+    }
+    const char *input = argv[argument];
+    const char *output = argv[argument + 1];
+
+    ImageTexture image(input);
+    const unsigned int width = image.getWidth(), height = image.getHeight();
+    if (width == 0 || height == 0) {
+        fprintf(stderr, "%s: cannot decode image\n", input);
+        return 1;
+    }
+
+    // Only keep the alpha channel if it is used.
+    const unsigned char *pixels = image.getData();
+    bool opaque = true;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(width) * height && opaque; i++) {
+        opaque = pixels[i * 4 + 3] == 255;
+    }
+    BlockCompression::Format format = BlockCompression::Bc1;
+    if (type == "mono") {
+        format = BlockCompression::Bc4;
+    } else if (!opaque && type != "normal") {
+        format = BlockCompression::Bc3;
+    }
+
+    const bool srgb = type == "srgb";
+    if (!BakedTexture::save(output, format, srgb, pixels, width, height)) {
+        return 1;
+    }
+
+    const char *formatNames[] = {"BC1", "BC3", "BC4"};
+    printf("Baked %s: %ux%u, %s%s with mipmaps.\n", input, width, height, formatNames[format], srgb ? " sRGB" : "");
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "src/utils/allocationCounter.h"
+
+#include <QDebug>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#ifdef FLOPPY_COUNT_ALLOCATIONS
+namespace {
+std::atomic<std::size_t> allocationCount{0}; /**< The amount of allocations since the start of the program */
+
+void* countedAllocate(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    // Allocating 0 bytes has to return a unique pointer.
+    void* pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+}  // namespace
+
+// Replace the global allocation functions, the nothrow versions forward to these.
+// Over-aligned allocations keep using the default implementation and are not counted.
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+
+std::size_t AllocationCounter::allocations() { return allocationCount.load(std::memory_order_relaxed); }
+#else
+std::size_t AllocationCounter::allocations() { return 0; }
+#endif
+
+AllocationTracker::AllocationTracker(std::string name, unsigned int warmUpFrames, unsigned int reportInterval)
+    : _name(std::move(name)),
+      _warmUpFrames(warmUpFrames),
+      _reportInterval(reportInterval),
+      _frame(0),
+      _start(0),
+      _allocations(0) {}
+
+void AllocationTracker::begin() { _start = AllocationCounter::allocations(); }
+
+void AllocationTracker::end() {
+    if (!AllocationCounter::enabled()) {
+        return;
+    }
+
+    // Ignore the frames in which buffers still grow.
+    std::size_t allocations = AllocationCounter::allocations() - _start;
+    _frame++;
+    if (_frame <= _warmUpFrames) {
+        return;
+    }
+
+    // Sum up the allocations and report them at the end of the interval.
+    _allocations += allocations;
+    if ((_frame - _warmUpFrames) % _reportInterval == 0) {
+        qDebug() << _name.c_str() << "made" << _allocations << "heap allocations in the last" << _reportInterval
+                 << "frames.";
+        _allocations = 0;
+    }
+}
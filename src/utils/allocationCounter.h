@@ -0,0 +1,69 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Counts the heap allocations of the whole program by replacing the global operator new.
+ *
+ * The counting is only compiled in with the CMake option FLOPPY_COUNT_ALLOCATIONS, otherwise no allocation
+ * is counted and the trackers stay silent.
+ */
+class AllocationCounter {
+   public:
+    /**
+     * @brief Whether the allocations are counted in this build.
+     * @return true if the program was built with FLOPPY_COUNT_ALLOCATIONS.
+     */
+    static constexpr bool enabled() {
+#ifdef FLOPPY_COUNT_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Returns the amount of heap allocations since the start of the program.
+     * @return the amount of allocations, always 0 if the counting is disabled.
+     */
+    static std::size_t allocations();
+};
+
+/**
+ * @brief Tracks the heap allocations of a function that is called once per frame.
+ *
+ * The first frames are ignored to let buffers grow to their steady-state size. Afterwards the allocations
+ * are summed up and reported once per report interval, a steady-state frame loop reports 0 allocations.
+ */
+class AllocationTracker {
+   public:
+    /**
+     * @brief Creates a tracker.
+     * @param name - the name of the tracked function, used in the report.
+     * @param warmUpFrames - the amount of frames to ignore.
+     * @param reportInterval - the amount of frames between two reports.
+     */
+    explicit AllocationTracker(std::string name, unsigned int warmUpFrames = 120, unsigned int reportInterval = 600);
+
+    /**
+     * @brief Marks the start of the tracked function.
+     */
+    void begin();
+
+    /**
+     * @brief Marks the end of the tracked function, reports the allocations at the end of every interval.
+     */
+    void end();
+
+   private:
+    std::string _name;            /**< The name of the tracked function */
+    unsigned int _warmUpFrames;   /**< The amount of frames that are not tracked */
+    unsigned int _reportInterval; /**< The amount of frames between two reports */
+    unsigned int _frame;          /**< The amount of tracked and ignored frames */
+    std::size_t _start;           /**< The allocation count at the start of the current frame */
+    std::size_t _allocations;     /**< The allocations of the current interval */
+};
+
+#endif  // ALLOCATION_COUNTER_H
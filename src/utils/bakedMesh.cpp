@@ -0,0 +1,119 @@
+#include "src/utils/bakedMesh.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace BakedMesh {
+
+static const char magic[4] = {'F', 'F', 'M', 'B'};
+
+bool save(const std::string& filename, const MeshData& mesh) {
+    Header header = {};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.vertexSize = sizeof(Vertex);
+    header.vertexAmount = mesh.vertices.size();
+    header.indexSize = mesh.indices.size();
+    header.partAmount = mesh.parts.size();
+    header.cornerAmount = mesh.cornerAmount;
+
+    std::vector<Part> parts(mesh.parts.size());
+    for (size_t i = 0; i < mesh.parts.size(); i++) {
+        const MeshRange& range = mesh.parts[i];
+        if (range.material.textureName.size() >= maxTextureNameSize) {
+            fprintf(stderr, "%s: texture name '%s' is too long\n", filename.c_str(),
+                    range.material.textureName.c_str());
+            return false;
+        }
+        parts[i] = {};
+        parts[i].baseVertex = range.baseVertex;
+        parts[i].vertexAmount = range.vertexAmount;
+        parts[i].indexOffset = range.indexOffset;
+        parts[i].indexAmount = range.indexAmount;
+        parts[i].indexSize = range.indexSize;
+        parts[i].shininess = range.material.shininess;
+        parts[i].transparency = range.material.transparency;
+        parts[i].emissiveColour[0] = range.material.emissiveColour.x;
+        parts[i].emissiveColour[1] = range.material.emissiveColour.y;
+        parts[i].emissiveColour[2] = range.material.emissiveColour.z;
+        std::memcpy(parts[i].textureName, range.material.textureName.c_str(), range.material.textureName.size());
+    }
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        fprintf(stderr, "%s: cannot open file for writing\n", filename.c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(parts.data()), parts.size() * sizeof(Part));
+    file.write(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(Vertex));
+    file.write(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size());
+    return file.good();
+}
+
+bool read(const unsigned char* data, std::size_t size, View& view) {
+    // Validate the header.
+    if (data == nullptr || size < sizeof(Header)) {
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version ||
+        header.vertexSize != sizeof(Vertex)) {
+        return false;
+    }
+
+    // Validate the size of the sections.
+    std::size_t partsOffset = sizeof(Header);
+    std::size_t verticesOffset = partsOffset + std::size_t(header.partAmount) * sizeof(Part);
+    std::size_t indicesOffset = verticesOffset + std::size_t(header.vertexAmount) * sizeof(Vertex);
+    if (indicesOffset + header.indexSize != size) {
+        return false;
+    }
+
+    // Copy the small part table, the vertices and indices stay where they are.
+    view.parts.clear();
+    view.parts.reserve(header.partAmount);
+    for (std::uint32_t i = 0; i < header.partAmount; i++) {
+        Part part;
+        std::memcpy(&part, data + partsOffset + i * sizeof(Part), sizeof(Part));
+        part.textureName[maxTextureNameSize - 1] = '\0';
+
+        // The indices of a part are 16- or 32-bit and aligned to their size, the rest must lie within the blob.
+        if ((part.indexSize != 2 && part.indexSize != 4) || part.indexOffset % part.indexSize != 0) {
+            return false;
+        }
+        if (std::size_t(part.indexOffset) + std::size_t(part.indexAmount) * part.indexSize > header.indexSize ||
+            std::size_t(part.baseVertex) + part.vertexAmount > header.vertexAmount) {
+            return false;
+        }
+
+        MeshRange range;
+        range.baseVertex = part.baseVertex;
+        range.vertexAmount = part.vertexAmount;
+        range.indexOffset = part.indexOffset;
+        range.indexAmount = part.indexAmount;
+        range.indexSize = part.indexSize;
+        range.material.textureName = part.textureName;
+        range.material.shininess = part.shininess;
+        range.material.transparency = part.transparency;
+        range.material.emissiveColour =
+            glm::vec3(part.emissiveColour[0], part.emissiveColour[1], part.emissiveColour[2]);
+        view.parts.push_back(range);
+    }
+
+    view.vertices = reinterpret_cast<const Vertex*>(data + verticesOffset);
+    view.vertexAmount = header.vertexAmount;
+    view.indices = data + indicesOffset;
+    view.indexSize = header.indexSize;
+    view.cornerAmount = header.cornerAmount;
+    return true;
+}
+
+std::string pathFor(const std::string& objPath) {
+    std::size_t extension = objPath.rfind(".obj");
+    return (extension != std::string::npos ? objPath.substr(0, extension) : objPath) + ".fmesh";
+}
+
+}  // namespace BakedMesh
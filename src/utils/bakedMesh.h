@@ -0,0 +1,91 @@
+#ifndef BAKED_MESH_H
+#define BAKED_MESH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/utils/meshLoader.h"
+#include "src/utils/vertex.h"
+
+/**
+ * @brief Binary mesh blobs, baked offline from an obj so the game can skip text parsing.
+ *
+ * A blob holds a header, the part table, the interleaved vertices and the raw indices, in that order and in the
+ * byte order of the baking machine. The vertices and indices are laid out exactly as the GPU consumes them, so a
+ * memory mapped blob can be handed to glBufferData directly.
+ */
+namespace BakedMesh {
+
+const std::uint32_t version = 1;           /**< Bumped whenever the layout of a blob changes. */
+const std::size_t maxTextureNameSize = 64; /**< Maximum length of a texture name including the terminator. */
+
+/**
+ * @brief Header at the start of every blob.
+ */
+struct Header {
+    char magic[4];              /**< Always "FFMB". */
+    std::uint32_t version;      /**< The version of the layout. */
+    std::uint32_t vertexSize;   /**< The size of a vertex, guards against changes of the vertex layout. */
+    std::uint32_t vertexAmount; /**< The amount of vertices. */
+    std::uint32_t indexSize;    /**< The size of the raw index data in bytes. */
+    std::uint32_t partAmount;   /**< The amount of parts. */
+    std::uint32_t cornerAmount; /**< The amount of face corners of the original obj. */
+    std::uint32_t reserved;     /**< Padding, always 0. */
+};
+
+/**
+ * @brief Entry of the part table, mirrors MeshRange and MeshMaterial.
+ */
+struct Part {
+    std::uint32_t baseVertex;             /**< The first vertex of the part. */
+    std::uint32_t vertexAmount;           /**< The amount of vertices of the part. */
+    std::uint32_t indexOffset;            /**< The offset of the first index of the part in bytes. */
+    std::uint32_t indexAmount;            /**< The amount of indices of the part. */
+    std::uint32_t indexSize;              /**< The size of a single index of the part in bytes. */
+    float shininess;                      /**< The shininess of the part. */
+    float transparency;                   /**< The transparency/dissolve/alpha of the part. */
+    float emissiveColour[3];              /**< The colour of the emission of the part. */
+    char textureName[maxTextureNameSize]; /**< The name of the texture file, zero terminated. */
+};
+
+/**
+ * @brief A parsed blob, the vertices and indices point into the memory the blob was read from.
+ */
+struct View {
+    const Vertex* vertices;       /**< The interleaved vertices. */
+    std::size_t vertexAmount;     /**< The amount of vertices. */
+    const unsigned char* indices; /**< The raw 16- or 32-bit indices of all parts. */
+    std::size_t indexSize;        /**< The size of the raw index data in bytes. */
+    unsigned int cornerAmount;    /**< The amount of face corners of the original obj. */
+    std::vector<MeshRange> parts; /**< The ranges and materials of the parts. */
+};
+
+/**
+ * @brief Writes a loaded mesh into a blob.
+ * @param filename the path of the blob.
+ * @param mesh the mesh to bake.
+ * @return true if it was successful.
+ */
+bool save(const std::string& filename, const MeshData& mesh);
+
+/**
+ * @brief Parses a blob without copying its vertices and indices.
+ * @param data the contents of the blob, usually memory mapped.
+ * @param size the size of the blob in bytes.
+ * @param view the parsed blob, pointing into data.
+ * @return true if the blob is valid and matches the current version and vertex layout.
+ */
+bool read(const unsigned char* data, std::size_t size, View& view);
+
+/**
+ * @brief Derives the path of the blob baked from an obj.
+ * @param objPath the path to the obj.
+ * @return the path of the blob.
+ */
+std::string pathFor(const std::string& objPath);
+
+}  // namespace BakedMesh
+
+#endif  // BAKED_MESH_H
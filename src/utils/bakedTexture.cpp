@@ -0,0 +1,153 @@
+#include "src/utils/bakedTexture.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace BakedTexture {
+
+static const char magic[4] = {'F', 'F', 'T', 'X'};
+
+/**
+ * @brief Halves an image with a box filter, a dimension of 1 stays 1.
+ * @param pixels the RGBA8888 pixels of the image.
+ * @param width the width of the image in pixels.
+ * @param height the height of the image in pixels.
+ * @param srgb whether the colours are averaged in linear space.
+ * @param result receives the pixels of the halved image.
+ */
+static void halve(const std::vector<std::uint8_t>& pixels, std::uint32_t width, std::uint32_t height, bool srgb,
+                  std::vector<std::uint8_t>& result) {
+    static float toLinear[256];
+    static bool initialized = false;
+    if (!initialized) {
+        for (int i = 0; i < 256; i++) {
+            float value = i / 255.0f;
+            toLinear[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+        }
+        initialized = true;
+    }
+    auto toSrgb = [](float value) {
+        value = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+        return value * 255.0f;
+    };
+
+    std::uint32_t halfWidth = std::max(width / 2, 1u), halfHeight = std::max(height / 2, 1u);
+    result.resize(static_cast<std::size_t>(halfWidth) * halfHeight * 4);
+    for (std::uint32_t y = 0; y < halfHeight; y++) {
+        for (std::uint32_t x = 0; x < halfWidth; x++) {
+            // Average the 2x2 source pixels, clamped for dimensions of 1.
+            std::uint32_t x0 = std::min(x * 2, width - 1), x1 = std::min(x * 2 + 1, width - 1);
+            std::uint32_t y0 = std::min(y * 2, height - 1), y1 = std::min(y * 2 + 1, height - 1);
+            const std::size_t sources[4] = {(static_cast<std::size_t>(y0) * width + x0) * 4,
+                                            (static_cast<std::size_t>(y0) * width + x1) * 4,
+                                            (static_cast<std::size_t>(y1) * width + x0) * 4,
+                                            (static_cast<std::size_t>(y1) * width + x1) * 4};
+            std::uint8_t* target = &result[(static_cast<std::size_t>(y) * halfWidth + x) * 4];
+            for (int channel = 0; channel < 4; channel++) {
+                float sum = 0.0f;
+                for (std::size_t source : sources) {
+                    std::uint8_t value = pixels[source + channel];
+                    sum += srgb && channel < 3 ? toLinear[value] : value;
+                }
+                float average = srgb && channel < 3 ? toSrgb(sum / 4.0f) : sum / 4.0f;
+                target[channel] = static_cast<std::uint8_t>(std::clamp(std::lround(average), 0l, 255l));
+            }
+        }
+    }
+}
+
+bool save(const std::string& filename, BlockCompression::Format format, bool srgb, const std::uint8_t* pixels,
+          std::uint32_t width, std::uint32_t height) {
+    if (pixels == nullptr || width == 0 || height == 0) {
+        fprintf(stderr, "%s: the image is empty\n", filename.c_str());
+        return false;
+    }
+
+    // Compress the levels from the largest to 1x1, every level is filtered from the previous one.
+    std::vector<Level> levels;
+    std::vector<std::uint8_t> blocks;
+    std::vector<std::uint8_t> level(pixels, pixels + static_cast<std::size_t>(width) * height * 4), nextLevel;
+    std::size_t dataOffset = sizeof(Header);
+    for (std::uint32_t levelWidth = width, levelHeight = height;;) {
+        std::size_t size = BlockCompression::compressedSize(format, levelWidth, levelHeight);
+        levels.push_back({static_cast<std::uint32_t>(blocks.size()), static_cast<std::uint32_t>(size)});
+        blocks.resize(blocks.size() + size);
+        BlockCompression::compress(format, level.data(), levelWidth, levelHeight, blocks.data() + levels.back().offset);
+        if (levelWidth == 1 && levelHeight == 1) {
+            break;
+        }
+        halve(level, levelWidth, levelHeight, srgb, nextLevel);
+        level.swap(nextLevel);
+        levelWidth = std::max(levelWidth / 2, 1u);
+        levelHeight = std::max(levelHeight / 2, 1u);
+    }
+    dataOffset += levels.size() * sizeof(Level);
+    for (Level& entry : levels) {
+        entry.offset += static_cast<std::uint32_t>(dataOffset);
+    }
+
+    Header header = {};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = version;
+    header.format = format;
+    header.srgb = srgb ? 1 : 0;
+    header.width = width;
+    header.height = height;
+    header.levelAmount = levels.size();
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        fprintf(stderr, "%s: cannot open file for writing\n", filename.c_str());
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(levels.data()), levels.size() * sizeof(Level));
+    file.write(reinterpret_cast<const char*>(blocks.data()), blocks.size());
+    return file.good();
+}
+
+bool read(const unsigned char* data, std::size_t size, View& view) {
+    // Validate the header.
+    if (data == nullptr || size < sizeof(Header)) {
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, magic, sizeof(magic)) != 0 || header.version != version ||
+        header.format > BlockCompression::Bc4 || header.width == 0 || header.height == 0 || header.levelAmount == 0 ||
+        header.levelAmount > 32 || sizeof(Header) + header.levelAmount * sizeof(Level) > size) {
+        return false;
+    }
+
+    // Validate every level against the dimensions it must have.
+    auto format = static_cast<BlockCompression::Format>(header.format);
+    view.format = format;
+    view.srgb = header.srgb != 0;
+    view.levels.clear();
+    view.levels.reserve(header.levelAmount);
+    std::uint32_t width = header.width, height = header.height;
+    for (std::uint32_t i = 0; i < header.levelAmount; i++) {
+        Level level;
+        std::memcpy(&level, data + sizeof(Header) + i * sizeof(Level), sizeof(Level));
+        if (level.size != BlockCompression::compressedSize(format, width, height) ||
+            std::size_t(level.offset) + level.size > size) {
+            return false;
+        }
+        view.levels.push_back({data + level.offset, level.size, width, height});
+        width = std::max(width / 2, 1u);
+        height = std::max(height / 2, 1u);
+    }
+    return true;
+}
+
+std::string pathFor(const std::string& imagePath) {
+    std::size_t extension = imagePath.rfind('.');
+    std::size_t directory = imagePath.find_last_of("/\\");
+    bool hasExtension = extension != std::string::npos && (directory == std::string::npos || extension > directory);
+    return (hasExtension ? imagePath.substr(0, extension) : imagePath) + ".ftex";
+}
+
+}  // namespace BakedTexture
@@ -0,0 +1,94 @@
+#ifndef BAKED_TEXTURE_H
+#define BAKED_TEXTURE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/utils/blockCompression.h"
+
+/**
+ * @brief Binary texture blobs, baked offline from an image into block compressed formats with a full mip chain.
+ *
+ * A blob holds a header, the level table and the blocks of all levels from the largest to the smallest, in that
+ * order and in the byte order of the baking machine. The blocks are laid out exactly as glCompressedTexImage2D
+ * consumes them, so the game neither decodes an image nor generates mipmaps at load time.
+ */
+namespace BakedTexture {
+
+const std::uint32_t version = 1; /**< Bumped whenever the layout of a blob changes. */
+
+/**
+ * @brief Header at the start of every blob.
+ */
+struct Header {
+    char magic[4];             /**< Always "FFTX". */
+    std::uint32_t version;     /**< The version of the layout. */
+    std::uint32_t format;      /**< The BlockCompression::Format of all levels. */
+    std::uint32_t srgb;        /**< 1 if the colours are sRGB encoded, 0 if they are linear. */
+    std::uint32_t width;       /**< The width of the largest level in pixels. */
+    std::uint32_t height;      /**< The height of the largest level in pixels. */
+    std::uint32_t levelAmount; /**< The amount of levels. */
+    std::uint32_t reserved;    /**< Padding, always 0. */
+};
+
+/**
+ * @brief Entry of the level table.
+ */
+struct Level {
+    std::uint32_t offset; /**< The offset of the blocks of the level from the start of the blob in bytes. */
+    std::uint32_t size;   /**< The size of the blocks of the level in bytes. */
+};
+
+/**
+ * @brief A level of a parsed blob, the blocks point into the memory the blob was read from.
+ */
+struct LevelView {
+    const unsigned char* data; /**< The blocks of the level. */
+    std::size_t size;          /**< The size of the blocks in bytes. */
+    std::uint32_t width;       /**< The width of the level in pixels. */
+    std::uint32_t height;      /**< The height of the level in pixels. */
+};
+
+/**
+ * @brief A parsed blob.
+ */
+struct View {
+    BlockCompression::Format format; /**< The format of all levels. */
+    bool srgb;                       /**< Whether the colours are sRGB encoded. */
+    std::vector<LevelView> levels;   /**< The levels from the largest to the smallest. */
+};
+
+/**
+ * @brief Builds the mip chain of an image down to 1x1, compresses every level and writes a blob.
+ * @param filename the path of the blob.
+ * @param format the format of the blocks.
+ * @param srgb whether the colours are sRGB encoded, the mip chain is then averaged in linear space.
+ * @param pixels the RGBA8888 pixels of the image, row by row from the top.
+ * @param width the width of the image in pixels.
+ * @param height the height of the image in pixels.
+ * @return true if it was successful.
+ */
+bool save(const std::string& filename, BlockCompression::Format format, bool srgb, const std::uint8_t* pixels,
+          std::uint32_t width, std::uint32_t height);
+
+/**
+ * @brief Parses a blob without copying its blocks.
+ * @param data the contents of the blob.
+ * @param size the size of the blob in bytes.
+ * @param view the parsed blob, pointing into data.
+ * @return true if the blob is valid and matches the current version.
+ */
+bool read(const unsigned char* data, std::size_t size, View& view);
+
+/**
+ * @brief Derives the path of the blob baked from an image.
+ * @param imagePath the path to the image.
+ * @return the path of the blob.
+ */
+std::string pathFor(const std::string& imagePath);
+
+}  // namespace BakedTexture
+
+#endif  // BAKED_TEXTURE_H
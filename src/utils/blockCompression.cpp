@@ -0,0 +1,301 @@
+#include "src/utils/blockCompression.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+namespace {
+/**
+ * @brief Packs a colour into RGB565 with rounding.
+ */
+std::uint16_t packRgb565(const float color[3]) {
+    auto quantize = [](float value, int maximum) {
+        float clamped = std::clamp(value, 0.0f, 255.0f);
+        return static_cast<std::uint16_t>(std::lround(clamped * maximum / 255.0f));
+    };
+    return static_cast<std::uint16_t>(quantize(color[0], 31) << 11 | quantize(color[1], 63) << 5 |
+                                      quantize(color[2], 31));
+}
+
+/**
+ * @brief Expands an RGB565 colour to 8 bits per channel, replicating the high bits into the low bits.
+ */
+void unpackRgb565(std::uint16_t packed, int color[3]) {
+    int red = packed >> 11 & 31, green = packed >> 5 & 63, blue = packed & 31;
+    color[0] = red << 3 | red >> 2;
+    color[1] = green << 2 | green >> 4;
+    color[2] = blue << 3 | blue >> 2;
+}
+
+/**
+ * @brief Computes the four colours of a BC1 block, the three colour mode adds transparent black.
+ */
+void colorPalette(std::uint16_t color0, std::uint16_t color1, bool fourColors, int palette[4][4]) {
+    unpackRgb565(color0, palette[0]);
+    unpackRgb565(color1, palette[1]);
+    palette[0][3] = palette[1][3] = 255;
+    for (int channel = 0; channel < 3; channel++) {
+        if (fourColors) {
+            palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+            palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+        } else {
+            palette[2][channel] = (palette[0][channel] + palette[1][channel]) / 2;
+            palette[3][channel] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = fourColors ? 255 : 0;
+}
+
+/**
+ * @brief Computes the eight values of a BC4 block, the six value mode adds 0 and 255.
+ */
+void valuePalette(int value0, int value1, int palette[8]) {
+    palette[0] = value0;
+    palette[1] = value1;
+    if (value0 > value1) {
+        for (int i = 1; i < 7; i++) {
+            palette[i + 1] = ((7 - i) * value0 + i * value1) / 7;
+        }
+    } else {
+        for (int i = 1; i < 5; i++) {
+            palette[i + 1] = ((5 - i) * value0 + i * value1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+/**
+ * @brief Encodes the colours of 16 RGBA pixels into a BC1 block in four colour mode.
+ *
+ * The end points are the extremes of the colours projected onto their principal axis,
+ * found by a few power iterations on the covariance matrix.
+ */
+void encodeColorBlock(const std::uint8_t pixels[64], std::uint8_t block[8]) {
+    float mean[3] = {0.0f, 0.0f, 0.0f};
+    for (int i = 0; i < 16; i++) {
+        for (int channel = 0; channel < 3; channel++) {
+            mean[channel] += pixels[i * 4 + channel] / 16.0f;
+        }
+    }
+    float covariance[3][3] = {};
+    for (int i = 0; i < 16; i++) {
+        float offset[3];
+        for (int channel = 0; channel < 3; channel++) {
+            offset[channel] = pixels[i * 4 + channel] - mean[channel];
+        }
+        for (int row = 0; row < 3; row++) {
+            for (int column = 0; column < 3; column++) {
+                covariance[row][column] += offset[row] * offset[column];
+            }
+        }
+    }
+    float axis[3] = {1.0f, 1.0f, 1.0f};
+    for (int iteration = 0; iteration < 8; iteration++) {
+        float next[3];
+        for (int row = 0; row < 3; row++) {
+            next[row] = covariance[row][0] * axis[0] + covariance[row][1] * axis[1] + covariance[row][2] * axis[2];
+        }
+        float length = std::max({std::fabs(next[0]), std::fabs(next[1]), std::fabs(next[2])});
+        if (length < 1e-6f) {
+            break;
+        }
+        for (int channel = 0; channel < 3; channel++) {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    // Project the colours onto the axis through the mean.
+    float minimum = 0.0f, maximum = 0.0f;
+    for (int i = 0; i < 16; i++) {
+        float projection = 0.0f;
+        for (int channel = 0; channel < 3; channel++) {
+            projection += (pixels[i * 4 + channel] - mean[channel]) * axis[channel];
+        }
+        minimum = std::min(minimum, projection);
+        maximum = std::max(maximum, projection);
+    }
+    float length = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    float end0[3], end1[3];
+    for (int channel = 0; channel < 3; channel++) {
+        end0[channel] = mean[channel] + axis[channel] * (length > 0.0f ? maximum / length : 0.0f);
+        end1[channel] = mean[channel] + axis[channel] * (length > 0.0f ? minimum / length : 0.0f);
+    }
+
+    // The four colour mode requires the first end point to be the larger one.
+    // Equal end points select the three colour mode, which is fine as every pixel then uses index 0.
+    std::uint16_t color0 = packRgb565(end0), color1 = packRgb565(end1);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+    int palette[4][4];
+    colorPalette(color0, color1, true, palette);
+
+    std::uint32_t indices = 0;
+    for (int i = 0; i < 16; i++) {
+        int best = 0, bestError = INT_MAX;
+        for (int entry = 0; entry < (color0 == color1 ? 1 : 4); entry++) {
+            int error = 0;
+            for (int channel = 0; channel < 3; channel++) {
+                int difference = pixels[i * 4 + channel] - palette[entry][channel];
+                error += difference * difference;
+            }
+            if (error < bestError) {
+                best = entry;
+                bestError = error;
+            }
+        }
+        indices |= static_cast<std::uint32_t>(best) << (2 * i);
+    }
+
+    block[0] = color0 & 0xff;
+    block[1] = color0 >> 8;
+    block[2] = color1 & 0xff;
+    block[3] = color1 >> 8;
+    for (int i = 0; i < 4; i++) {
+        block[4 + i] = indices >> (8 * i) & 0xff;
+    }
+}
+
+/**
+ * @brief Encodes one channel of 16 RGBA pixels into a BC4 block in eight value mode.
+ */
+void encodeValueBlock(const std::uint8_t pixels[64], int channel, std::uint8_t block[8]) {
+    int minimum = 255, maximum = 0;
+    for (int i = 0; i < 16; i++) {
+        minimum = std::min<int>(minimum, pixels[i * 4 + channel]);
+        maximum = std::max<int>(maximum, pixels[i * 4 + channel]);
+    }
+    int palette[8];
+    valuePalette(maximum, minimum, palette);
+
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 16; i++) {
+        int best = 0, bestError = 256;
+        for (int entry = 0; entry < (maximum == minimum ? 1 : 8); entry++) {
+            int error = std::abs(pixels[i * 4 + channel] - palette[entry]);
+            if (error < bestError) {
+                best = entry;
+                bestError = error;
+            }
+        }
+        indices |= static_cast<std::uint64_t>(best) << (3 * i);
+    }
+
+    block[0] = static_cast<std::uint8_t>(maximum);
+    block[1] = static_cast<std::uint8_t>(minimum);
+    for (int i = 0; i < 6; i++) {
+        block[2 + i] = indices >> (8 * i) & 0xff;
+    }
+}
+
+/**
+ * @brief Decodes a BC1 colour block into 16 RGBA pixels, BC3 always uses the four colour mode.
+ */
+void decodeColorBlock(const std::uint8_t block[8], bool alwaysFourColors, std::uint8_t pixels[64]) {
+    std::uint16_t color0 = block[0] | block[1] << 8, color1 = block[2] | block[3] << 8;
+    int palette[4][4];
+    colorPalette(color0, color1, alwaysFourColors || color0 > color1, palette);
+    std::uint32_t indices = block[4] | block[5] << 8 | block[6] << 16 | static_cast<std::uint32_t>(block[7]) << 24;
+    for (int i = 0; i < 16; i++) {
+        const int* color = palette[indices >> (2 * i) & 3];
+        for (int channel = 0; channel < 4; channel++) {
+            pixels[i * 4 + channel] = static_cast<std::uint8_t>(color[channel]);
+        }
+    }
+}
+
+/**
+ * @brief Decodes a BC4 block into one channel of 16 RGBA pixels.
+ */
+void decodeValueBlock(const std::uint8_t block[8], int channel, std::uint8_t pixels[64]) {
+    int palette[8];
+    valuePalette(block[0], block[1], palette);
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; i++) {
+        indices |= static_cast<std::uint64_t>(block[2 + i]) << (8 * i);
+    }
+    for (int i = 0; i < 16; i++) {
+        pixels[i * 4 + channel] = static_cast<std::uint8_t>(palette[indices >> (3 * i) & 7]);
+    }
+}
+}  // namespace
+
+namespace BlockCompression {
+
+std::size_t blockSize(Format format) { return format == Bc3 ? 16 : 8; }
+
+std::size_t compressedSize(Format format, std::uint32_t width, std::uint32_t height) {
+    return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * blockSize(format);
+}
+
+void compress(Format format, const std::uint8_t* pixels, std::uint32_t width, std::uint32_t height,
+              std::uint8_t* blocks) {
+    std::uint8_t blockPixels[64];
+    for (std::uint32_t blockY = 0; blockY < height; blockY += 4) {
+        for (std::uint32_t blockX = 0; blockX < width; blockX += 4) {
+            // Gather the pixels of the block, clamped to the image.
+            for (std::uint32_t y = 0; y < 4; y++) {
+                for (std::uint32_t x = 0; x < 4; x++) {
+                    std::size_t source = (static_cast<std::size_t>(std::min(blockY + y, height - 1)) * width +
+                                          std::min(blockX + x, width - 1)) *
+                                         4;
+                    std::memcpy(blockPixels + (y * 4 + x) * 4, pixels + source, 4);
+                }
+            }
+
+            switch (format) {
+                case Bc1:
+                    encodeColorBlock(blockPixels, blocks);
+                    break;
+                case Bc3:
+                    encodeValueBlock(blockPixels, 3, blocks);
+                    encodeColorBlock(blockPixels, blocks + 8);
+                    break;
+                case Bc4:
+                    encodeValueBlock(blockPixels, 0, blocks);
+                    break;
+            }
+            blocks += blockSize(format);
+        }
+    }
+}
+
+void decompress(Format format, const std::uint8_t* blocks, std::uint32_t width, std::uint32_t height,
+                std::uint8_t* pixels) {
+    std::uint8_t blockPixels[64];
+    for (std::uint32_t blockY = 0; blockY < height; blockY += 4) {
+        for (std::uint32_t blockX = 0; blockX < width; blockX += 4) {
+            switch (format) {
+                case Bc1:
+                    decodeColorBlock(blocks, false, blockPixels);
+                    break;
+                case Bc3:
+                    decodeColorBlock(blocks + 8, true, blockPixels);
+                    decodeValueBlock(blocks, 3, blockPixels);
+                    break;
+                case Bc4:
+                    for (int i = 0; i < 16; i++) {
+                        blockPixels[i * 4 + 1] = blockPixels[i * 4 + 2] = 0;
+                        blockPixels[i * 4 + 3] = 255;
+                    }
+                    decodeValueBlock(blocks, 0, blockPixels);
+                    break;
+            }
+            blocks += blockSize(format);
+
+            // Scatter the pixels of the block that lie inside the image.
+            for (std::uint32_t y = 0; y < 4 && blockY + y < height; y++) {
+                std::uint32_t columns = std::min<std::uint32_t>(4, width - blockX);
+                std::memcpy(pixels + ((static_cast<std::size_t>(blockY + y)) * width + blockX) * 4,
+                            blockPixels + y * 16, columns * 4);
+            }
+        }
+    }
+}
+
+}  // namespace BlockCompression
@@ -0,0 +1,67 @@
+#ifndef BLOCK_COMPRESSION_H
+#define BLOCK_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Encoders and decoders of the BC1, BC3 and BC4 block compression formats.
+ *
+ * The formats split an image into blocks of 4x4 pixels. BC1 stores two RGB565 end points and a 2-bit index per
+ * pixel (8 bytes per block), BC4 stores two 8-bit end points and a 3-bit index per pixel of a single channel
+ * (8 bytes per block) and BC3 combines a BC4 alpha block with a BC1 colour block (16 bytes per block).
+ * The encoders fit the end points to the principal axis of the colours of a block, which is fast and good enough
+ * for offline baking. The decoders serve as a fallback for drivers without S3TC support.
+ */
+namespace BlockCompression {
+
+/**
+ * @brief The block compression formats.
+ */
+enum Format {
+    Bc1, /**< Opaque RGB, 8 bytes per block */
+    Bc3, /**< RGBA with interpolated alpha, 16 bytes per block */
+    Bc4, /**< A single channel taken from red, 8 bytes per block */
+};
+
+/**
+ * @brief Returns the size of a block.
+ * @param format - the format.
+ * @return the size of a block in bytes.
+ */
+std::size_t blockSize(Format format);
+
+/**
+ * @brief Returns the size of a compressed image, the blocks at the right and bottom border may be partial.
+ * @param format - the format.
+ * @param width - the width of the image in pixels.
+ * @param height - the height of the image in pixels.
+ * @return the size of the compressed image in bytes.
+ */
+std::size_t compressedSize(Format format, std::uint32_t width, std::uint32_t height);
+
+/**
+ * @brief Compresses an RGBA8888 image, partial blocks repeat the pixels at the border.
+ * @param format - the format.
+ * @param pixels - the pixels, row by row from the top.
+ * @param width - the width of the image in pixels.
+ * @param height - the height of the image in pixels.
+ * @param blocks - receives compressedSize() bytes, the blocks row by row from the top.
+ */
+void compress(Format format, const std::uint8_t* pixels, std::uint32_t width, std::uint32_t height,
+              std::uint8_t* blocks);
+
+/**
+ * @brief Decompresses an image into RGBA8888, BC4 is expanded into red with opaque alpha.
+ * @param format - the format.
+ * @param blocks - the blocks, row by row from the top.
+ * @param width - the width of the image in pixels.
+ * @param height - the height of the image in pixels.
+ * @param pixels - receives width * height * 4 bytes, row by row from the top.
+ */
+void decompress(Format format, const std::uint8_t* blocks, std::uint32_t width, std::uint32_t height,
+                std::uint8_t* pixels);
+
+}  // namespace BlockCompression
+
+#endif  // BLOCK_COMPRESSION_H
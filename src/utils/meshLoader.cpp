@@ -0,0 +1,163 @@
+#include "src/utils/meshLoader.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+#include "lib/tinyobj/tiny_obj_loader.h"
+
+namespace {
+
+// FNV-1a over the bytes of a packed vertex. Vertices are welded by their packed bytes, the layout has no padding.
+struct VertexHash {
+    std::size_t operator()(const Vertex& vertex) const {
+        std::uint64_t hash = 14695981039346656037ull;
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&vertex);
+        for (std::size_t i = 0; i < sizeof(Vertex); i++) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(hash);
+    }
+};
+
+// Compares the bytes of two packed vertices.
+struct VertexEqual {
+    bool operator()(const Vertex& first, const Vertex& second) const {
+        return std::memcmp(&first, &second, sizeof(Vertex)) == 0;
+    }
+};
+
+// Appends the given indices with the given index size to the raw index data.
+template <typename Index>
+void appendIndices(std::vector<unsigned char>& data, const std::vector<unsigned int>& indices) {
+    size_t offset = data.size();
+    data.resize(offset + indices.size() * sizeof(Index));
+    for (size_t i = 0; i < indices.size(); i++) {
+        Index index = static_cast<Index>(indices[i]);
+        std::memcpy(data.data() + offset + i * sizeof(Index), &index, sizeof(Index));
+    }
+}
+
+}  // namespace
+
+namespace MeshLoader {
+
+bool loadObj(const std::string& filename, MeshData& mesh) {
+    mesh = MeshData();
+
+    // Use V2 API of tiny obj loader.
+    // Create config for loading.
+    tinyobj::ObjReaderConfig objReaderConfig = tinyobj::ObjReaderConfig();
+    // Disable vertex colour.
+    objReaderConfig.vertex_color = false;
+
+    // Parse the file.
+    auto objReader = tinyobj::ObjReader();
+    if (!objReader.ParseFromFile(filename, objReaderConfig)) {
+        fprintf(stderr, "%s\n", objReader.Error().c_str());
+        return false;
+    }
+
+    // Reference the parsed data, the reader keeps ownership.
+    const std::vector<tinyobj::shape_t>& shapes = objReader.GetShapes();
+    const tinyobj::attrib_t& attributes = objReader.GetAttrib();
+    const std::vector<tinyobj::material_t>& materials = objReader.GetMaterials();
+
+    // Validate.
+    if (shapes.empty() || attributes.vertices.empty() || attributes.vertices.size() % 3 != 0 ||
+        attributes.normals.size() % 3 != 0 || attributes.texcoords.size() % 2 != 0) {
+        fprintf(stderr, "%s: cannot understand data\n", filename.c_str());
+        return false;
+    }
+    size_t indexAmount = 0;
+    for (const tinyobj::shape_t& shape : shapes) {
+        if (shape.mesh.indices.empty() || shape.mesh.indices.size() % 3 != 0) {
+            fprintf(stderr, "%s: cannot understand data\n", filename.c_str());
+            return false;
+        }
+        indexAmount += shape.mesh.indices.size();
+    }
+
+    mesh.cornerAmount = indexAmount;
+    mesh.vertices.reserve(indexAmount);
+    mesh.indices.reserve(indexAmount * sizeof(unsigned int));
+    mesh.parts.reserve(shapes.size());
+
+    // Welded vertices of the current part and their index relative to the base vertex of the part.
+    std::unordered_map<Vertex, unsigned int, VertexHash, VertexEqual> weldedVertices;
+    std::vector<unsigned int> partIndices;
+
+    // Append every part to the shared arrays and remember its range.
+    for (const tinyobj::shape_t& shape : shapes) {
+        MeshRange range;
+        range.baseVertex = mesh.vertices.size();
+        range.indexAmount = shape.mesh.indices.size();
+
+        weldedVertices.clear();
+        weldedVertices.reserve(shape.mesh.indices.size());
+        partIndices.clear();
+        partIndices.reserve(shape.mesh.indices.size());
+
+        for (const tinyobj::index_t& index : shape.mesh.indices) {
+            int vertPosition = index.vertex_index;
+            int vertNormal = index.normal_index;
+            int vertTexCoord = index.texcoord_index;
+
+            // Adding +0 turns -0 into +0, the two compare equal but differ in their bytes. The packed normal has no -0.
+            Vertex vertex(glm::vec3(attributes.vertices[3 * vertPosition + 0] + 0.0f,
+                                    attributes.vertices[3 * vertPosition + 1] + 0.0f,
+                                    attributes.vertices[3 * vertPosition + 2] + 0.0f),
+                          vertNormal >= 0 ? glm::vec3(attributes.normals[3 * vertNormal + 0],
+                                                      attributes.normals[3 * vertNormal + 1],
+                                                      attributes.normals[3 * vertNormal + 2])
+                                          : glm::vec3(0.0f),
+                          vertTexCoord >= 0 ? glm::vec2(attributes.texcoords[2 * vertTexCoord + 0] + 0.0f,
+                                                        attributes.texcoords[2 * vertTexCoord + 1] + 0.0f)
+                                            : glm::vec2(0.0f));
+
+            // Only emit a new vertex if its packed attributes were not seen before in this part.
+            unsigned int nextIndex = weldedVertices.size();
+            auto [welded, inserted] = weldedVertices.try_emplace(vertex, nextIndex);
+            if (inserted) {
+                mesh.vertices.push_back(vertex);
+            }
+            partIndices.push_back(welded->second);
+        }
+        range.vertexAmount = weldedVertices.size();
+
+        // Use 16-bit indices if the part is small enough, aligning every part to 4 bytes.
+        range.indexSize = range.vertexAmount <= 65536 ? 2 : 4;
+        mesh.indices.resize((mesh.indices.size() + 3) & ~size_t(3));
+        range.indexOffset = mesh.indices.size();
+        if (range.indexSize == 2) {
+            appendIndices<std::uint16_t>(mesh.indices, partIndices);
+        } else {
+            appendIndices<std::uint32_t>(mesh.indices, partIndices);
+        }
+
+        // Set material properties.
+        // Assume each mesh part has a distinct material, i.e. no other face has a different material.
+        int materialIndex = shape.mesh.material_ids.empty() ? -1 : shape.mesh.material_ids[0];
+        if (materialIndex >= 0 && materialIndex < static_cast<int>(materials.size())) {
+            const tinyobj::material_t& material = materials[materialIndex];
+            range.material.textureName = material.diffuse_texname;
+            range.material.shininess = material.shininess;
+            range.material.transparency = material.dissolve;
+            range.material.emissiveColour =
+                glm::vec3(material.emission[0], material.emission[1], material.emission[2]);
+        } else {
+            range.material.textureName = "";
+            range.material.shininess = 0.5f;
+            range.material.transparency = 1.0f;
+            range.material.emissiveColour = glm::vec3(0.0f);
+        }
+
+        mesh.parts.push_back(range);
+    }
+
+    return true;
+}
+
+}  // namespace MeshLoader
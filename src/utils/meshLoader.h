@@ -0,0 +1,59 @@
+#ifndef MESH_LOADER_H
+#define MESH_LOADER_H
+
+#include <string>
+#include <vector>
+
+#include "glm/ext/vector_float3.hpp"
+#include "src/utils/vertex.h"
+
+/**
+ * @brief The material of a single part of a mesh.
+ */
+struct MeshMaterial {
+    std::string textureName;  /**< The name of the texture file. */
+    float shininess;          /**< The shininess of the part. */
+    float transparency;       /**< The transparency/dissolve/alpha of the part. */
+    glm::vec3 emissiveColour; /**< The colour of the emission of the part. */
+};
+
+/**
+ * @brief The range of a single part inside the vertex and index buffers of a mesh.
+ *
+ * The indices of a part are relative to its base vertex, so parts with at most 65536 vertices use 16-bit indices.
+ */
+struct MeshRange {
+    unsigned int baseVertex;   /**< The first vertex of the part. */
+    unsigned int vertexAmount; /**< The amount of distinct vertices of the part. */
+    unsigned int indexOffset;  /**< The offset of the first index of the part in bytes. */
+    unsigned int indexAmount;  /**< The amount of indices of the part. */
+    unsigned int indexSize;    /**< The size of a single index of the part in bytes, either 2 or 4. */
+    MeshMaterial material;     /**< The material of the part. */
+};
+
+/**
+ * @brief CPU-side geometry of a mesh, all parts share the vertex and index arrays.
+ */
+struct MeshData {
+    std::vector<Vertex> vertices;       /**< The welded, interleaved vertices of all parts. */
+    std::vector<unsigned char> indices; /**< The raw 16- or 32-bit indices of all parts. */
+    unsigned int cornerAmount;          /**< The amount of face corners before welding. */
+    std::vector<MeshRange> parts;       /**< The ranges of the individual parts. */
+};
+
+namespace MeshLoader {
+
+/**
+ * @brief Loads all parts of a mesh from an obj, parsing the file only once.
+ *
+ * Face corners whose position, normal and texture coordinate pack into identical vertices are welded into a single
+ * vertex.
+ * @param filename the path to the obj.
+ * @param mesh the loaded geometry, materials and part ranges.
+ * @return true if it was successful.
+ */
+bool loadObj(const std::string& filename, MeshData& mesh);
+
+}  // namespace MeshLoader
+
+#endif  // MESH_LOADER_H
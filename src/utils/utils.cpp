@@ -33,8 +33,7 @@ void _glCheckError(const char *file, int line) {
     }
 }
 
-void geom_cube(std::vector<glm::vec3> &positions, std::vector<glm::vec3> &normals, std::vector<glm::vec2> &texcoords,
-               std::vector<unsigned int> &indices) {
+void geom_cube(std::vector<Vertex> &vertices, std::vector<unsigned int> &indices) {
     static const float p[] = {
         -1.0f, +1.0f, +1.0f, +1.0f, +1.0f, +1.0f, +1.0f, -1.0f, +1.0f, -1.0f, -1.0f, +1.0f,  // front
         -1.0f, +1.0f, -1.0f, +1.0f, +1.0f, -1.0f, +1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f,  // back
@@ -67,12 +66,11 @@ void geom_cube(std::vector<glm::vec3> &positions, std::vector<glm::vec3> &normal
         16, 17, 19, 17, 18, 19,  // top face
         20, 21, 23, 21, 22, 23,  // bottom face
     };
-    static const glm::vec3 *vp = reinterpret_cast<const glm::vec3 *>(p);
-    static const glm::vec3 *vn = reinterpret_cast<const glm::vec3 *>(n);
-    static const glm::vec2 *vt = reinterpret_cast<const glm::vec2 *>(t);
-    positions.assign(vp, vp + sizeof(p) / sizeof(glm::vec3));
-    normals.assign(vn, vn + sizeof(n) / sizeof(glm::vec3));
-    texcoords.assign(vt, vt + sizeof(t) / sizeof(glm::vec2));
+    vertices.clear();
+    for (size_t v = 0; v < sizeof(t) / sizeof(float) / 2; v++) {
+        vertices.emplace_back(glm::vec3(p[3 * v + 0], p[3 * v + 1], p[3 * v + 2]),
+                              glm::vec3(n[3 * v + 0], n[3 * v + 1], n[3 * v + 2]), glm::vec2(t[2 * v + 0], t[2 * v + 1]));
+    }
     indices.assign(i, i + sizeof(i) / sizeof(unsigned int));
 }
 
@@ -4,6 +4,9 @@
 #include <QOpenGLFunctions>
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
+#include <vector>
+
+#include "src/utils/vertex.h"
 
 namespace Utils {
 
@@ -16,13 +19,10 @@ void _glCheckError(const char* file, int line);
 
 /**
  * Generates a cube.
- * @param positions of the generated cube.
- * @param normals of the generated cube.
- * @param texcoords of the generated cube.
+ * @param vertices of the generated cube.
  * @param indices of the generated cube.
  */
-void geom_cube(std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals, std::vector<glm::vec2>& texcoords,
-               std::vector<unsigned int>& indices);
+void geom_cube(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
 
 }  // namespace Utils
 
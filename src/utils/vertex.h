@@ -0,0 +1,38 @@
+#ifndef VERTEX_H
+#define VERTEX_H
+
+#include <cstdint>
+
+#include "glm/ext/vector_float2.hpp"
+#include "glm/ext/vector_float3.hpp"
+#include "glm/ext/vector_float4.hpp"
+#include "glm/gtc/packing.hpp"
+
+/**
+ * @brief The interleaved vertex layout shared by all drawables.
+ *
+ * Positions stay in full precision, normals are packed as signed normalized 10_10_10_2 and texture coordinates
+ * as half floats, which shrinks a vertex from 32 to 20 bytes.
+ */
+struct Vertex {
+    glm::vec3 position;                 /**< The position in full precision. */
+    std::uint32_t normal;               /**< The normal packed as signed normalized 10_10_10_2. */
+    std::uint16_t textureCoordinate[2]; /**< The texture coordinate as half floats. */
+
+    Vertex() : position(0.0f), normal(0), textureCoordinate{0, 0} {}
+
+    /**
+     * @brief Packs the attributes of a vertex.
+     * @param position - the position of the vertex.
+     * @param normal - the normal of the vertex.
+     * @param textureCoordinate - the texture coordinate of the vertex.
+     */
+    Vertex(const glm::vec3& position, const glm::vec3& normal, const glm::vec2& textureCoordinate)
+        : position(position),
+          normal(glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f))),
+          textureCoordinate{glm::packHalf1x16(textureCoordinate.x), glm::packHalf1x16(textureCoordinate.y)} {}
+};
+
+static_assert(sizeof(Vertex) == 20, "The vertex layout must stay tightly packed.");
+
+#endif  // VERTEX_H